@@ -179,6 +179,12 @@ For more information see :func:`ansys.mapdl.core.launcher.launch_mapdl`.""",
     type=str,
     help="Version of MAPDL to launch. If ``None``, the latest version is used. Versions can be provided as integers (i.e. ``version=222``) or floats (i.e. ``version=22.2``). To retrieve the available installed versions, use the function :meth:`ansys.tools.path.path.get_available_ansys_installations`.",
 )
+@click.option(
+    "--prewarm",
+    default=None,
+    type=int,
+    help="Start a warm pool which keeps this number of MAPDL instances launched in the background instead of launching a single instance. Use ``launch_mapdl(prewarmed=True)`` to get one of these instances almost immediately. The argument ``port`` is used as the first port for the instances.",
+)
 def start(
     exec_file: str,
     run_location: str,
@@ -205,6 +211,7 @@ def start(
     add_env_vars: Dict[str, str],  # ignored
     replace_env_vars: Dict[str, str],  # ignored
     version: Union[int, str],
+    prewarm: int,
 ):
     from ansys.mapdl.core.launcher import launch_mapdl
 
@@ -296,6 +303,34 @@ def start(
     if "PYMAPDL_START_INSTANCE" in os.environ:
         os.environ.pop("PYMAPDL_START_INSTANCE")
 
+    if prewarm:
+        from ansys.mapdl.core.warm_pool import start_warm_pool_daemon
+
+        launch_kwargs = {
+            "exec_file": exec_file,
+            "run_location": run_location,
+            "jobname": jobname,
+            "nproc": nproc,
+            "ram": ram,
+            "override": override,
+            "additional_switches": additional_switches,
+            "start_timeout": start_timeout,
+            "license_type": license_type,
+            "version": version,
+        }
+        launch_kwargs = {
+            key: value for key, value in launch_kwargs.items() if value is not None
+        }
+        if port:
+            launch_kwargs["starting_port"] = port
+
+        process = start_warm_pool_daemon(prewarm, **launch_kwargs)
+        click.echo(
+            click.style("Success: ", fg="green")
+            + f"Started a warm pool (PID={process.pid}) with {prewarm} MAPDL instances."
+        )
+        return
+
     out = launch_mapdl(
         exec_file=exec_file,
         just_launch=True,
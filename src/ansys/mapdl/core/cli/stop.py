@@ -55,9 +55,30 @@ By default, it stops instances running on the port 50052.""",
     default=False,
     help="Kill all MAPDL instances",
 )
-def stop(port, pid, all):
+@click.option(
+    "--warm_pool",
+    is_flag=True,
+    flag_value=True,
+    type=bool,
+    default=False,
+    help="Stop the warm pool started with ``pymapdl start --prewarm``.",
+)
+def stop(port, pid, all, warm_pool):
     import psutil
 
+    if warm_pool:
+        from ansys.mapdl.core.warm_pool import request_warm_pool
+
+        if request_warm_pool("stop") is None:
+            click.echo(
+                click.style("ERROR: ", fg="red") + "No warm pool has been found."
+            )
+        else:
+            click.echo(
+                click.style("Success: ", fg="green") + "The warm pool has been stopped."
+            )
+        return
+
     PROCESS_OK_STATUS = [
         # List of all process status, comment out the ones that means that
         # process is not OK.
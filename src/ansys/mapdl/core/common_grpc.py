@@ -21,7 +21,9 @@
 # SOFTWARE.
 
 """Common gRPC functions"""
-from typing import List, Literal, get_args
+import math
+import threading
+from typing import List, Literal, Optional, get_args
 
 import numpy as np
 
@@ -31,6 +33,10 @@ from ansys.mapdl.core.errors import MapdlConnectionError, MapdlRuntimeError
 DEFAULT_CHUNKSIZE = 256 * 1024  # 256 kB
 DEFAULT_FILE_CHUNK_SIZE = 1024 * 1024  # 1MB
 
+# Bounds of the adaptive chunk size
+MIN_CHUNKSIZE = 64 * 1024  # 64 kB
+MAX_CHUNKSIZE = 2 * 1024 * 1024  # 2 MB
+
 ANSYS_VALUE_TYPE = {
     0: None,  # UNKNOWN
     1: np.int32,  # INTEGER
@@ -92,6 +98,75 @@ class GrpcError(MapdlRuntimeError):
         super().__init__(self, msg)
 
 
+class AdaptiveChunkSize:
+    """Chunk size following the measured transfer throughput.
+
+    The size is chosen so each chunk takes about ``target_time`` seconds to
+    be transferred. Small chunks keep the progress and the interruptions
+    responsive on slow links, while large chunks reduce the per message
+    overhead on fast links.
+
+    Parameters
+    ----------
+    size : int, optional
+        Initial chunk size in bytes. The default is 256 kB.
+
+    min_size : int, optional
+        Minimum chunk size in bytes. The default is 64 kB.
+
+    max_size : int, optional
+        Maximum chunk size in bytes. The default is 2 MB.
+
+    target_time : float, optional
+        Time in seconds to transfer one chunk. The default is ``0.1``.
+
+    smoothing : float, optional
+        Weight of the last transfer in the throughput average. The default
+        is ``0.5``.
+    """
+
+    def __init__(
+        self,
+        size: int = DEFAULT_CHUNKSIZE,
+        min_size: int = MIN_CHUNKSIZE,
+        max_size: int = MAX_CHUNKSIZE,
+        target_time: float = 0.1,
+        smoothing: float = 0.5,
+    ):
+        self.size = size
+        self.min_size = min_size
+        self.max_size = max_size
+        self.target_time = target_time
+        self.smoothing = smoothing
+        self.throughput: Optional[float] = None  # bytes per second
+        self._lock = threading.Lock()
+
+    def __repr__(self):
+        return f"AdaptiveChunkSize(size={self.size}, throughput={self.throughput})"
+
+    def record(self, n_bytes: int, elapsed: float) -> None:
+        """Update the chunk size with the bytes transferred in ``elapsed`` seconds.
+
+        Transfers smaller than ``min_size`` are dominated by the latency and
+        are ignored.
+        """
+        if elapsed <= 0 or n_bytes < self.min_size:
+            return
+
+        with self._lock:
+            rate = n_bytes / elapsed
+            if self.throughput is None:
+                self.throughput = rate
+            else:
+                self.throughput = (
+                    self.smoothing * rate + (1 - self.smoothing) * self.throughput
+                )
+
+            # Rounded to a power of two so small fluctuations do not change it
+            size = 2 ** round(math.log2(max(self.throughput * self.target_time, 1)))
+            self.size = int(min(max(size, self.min_size), self.max_size))
+
+
 def check_vget_input(entity: str, item: str, itnum: str) -> str:
     """Verify that entity and item for VGET are valid.
 
@@ -167,6 +242,33 @@ def check_vget_input(entity: str, item: str, itnum: str) -> str:
     return "%s, , %s, %s" % (entity, item, itnum)
 
 
+def iter_chunks(chunks, dtype):
+    """Deserialize gRPC chunks into numpy arrays, one chunk at a time.
+
+    Unlike :func:`parse_chunks`, the chunks are never concatenated, so
+    the memory usage is bounded by the chunk size.
+
+    Parameters
+    ----------
+    chunks : generator
+        generator from grpc.  Each chunk contains a bytes payload
+
+    dtype : np.dtype
+        Numpy data type to interpret chunks as.
+
+    Yields
+    ------
+    np.ndarray
+        Read-only array of each chunk.
+
+    """
+    if not chunks.is_active():
+        raise MapdlConnectionError("The channel is not alive.")
+
+    for chunk in chunks:
+        yield np.frombuffer(chunk.payload, dtype)
+
+
 def parse_chunks(chunks, dtype=None):
     """Deserialize gRPC chunks into a numpy array
 
@@ -21,6 +21,7 @@
 # SOFTWARE.
 
 """Contains the MapdlDb classes, allowing the access to MAPDL DB from Python."""
+from collections import deque
 from enum import Enum
 from functools import wraps
 import os
@@ -39,6 +40,9 @@ from ..mapdl_grpc import MapdlGrpc
 MINIMUM_MAPDL_VERSION = "21.1"
 FAILING_DATABASE_MAPDL = ["24.1", "24.2"]
 
+# Maximum number of push requests waiting for a response.
+PUSH_BATCH_SIZE = 1024
+
 
 class WithinBeginLevel:
     """Context manager to run MAPDL within the being level."""
@@ -379,6 +383,36 @@ class MapdlDb:
 
         return self._mapdl.run(f"SAVE,{fname},,,{option}")
 
+    def _push_many(self, rpc, requests, batch_size=PUSH_BATCH_SIZE):
+        """Send many unary requests without waiting for each response.
+
+        Up to ``batch_size`` requests are in flight at the same time, so
+        the round trip latency is paid once per batch instead of once
+        per request.  The order in which the server processes the
+        requests is not guaranteed.
+
+        Returns the number of requests sent.
+        """
+        if batch_size < 1:
+            raise ValueError("``batch_size`` must be a positive integer")
+
+        pending = deque()
+        n_sent = 0
+        try:
+            for request in requests:
+                pending.append(rpc.future(request))
+                n_sent += 1
+                if len(pending) >= batch_size:
+                    pending.popleft().result()
+
+            while pending:
+                pending.popleft().result()
+        finally:
+            for future in pending:
+                future.cancel()
+
+        return n_sent
+
     def clear(self, **kwargs):
         """
         Delete everything in the MAPDL database.
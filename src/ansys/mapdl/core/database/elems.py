@@ -28,11 +28,15 @@ This allows lower level the access to the elements in the MAPDL database.
 """
 import weakref
 
+from ansys.api.mapdl.v0 import ansys_kernel_pb2 as anskernel
 from ansys.api.mapdl.v0 import mapdl_db_pb2
+import numpy as np
 
 from ansys.mapdl.core.errors import MapdlRuntimeError
 
 from . import DBDef, MapdlDb, check_mapdl_db_is_alive
+from ..common_grpc import DEFAULT_CHUNKSIZE, parse_chunks
+from .database import PUSH_BATCH_SIZE
 
 
 class DbElems:
@@ -368,6 +372,90 @@ class DbElems:
         request = mapdl_db_pb2.getelmRequest(ielem=ielm)
         return self._db._stub.getElm(request)
 
+    @check_mapdl_db_is_alive
+    def all_asarray(self):
+        """
+        Return all element numbers, element data and nodes as arrays.
+
+        The elements are streamed in chunks in a single request, instead
+        of requesting each element with :func:`DbElems.get()
+        <ansys.mapdl.core.database.elems.DbElems.get>`.
+
+        .. note::
+           This only returns data of the selected elements.
+
+        Returns
+        -------
+        np.ndarray
+            Numpy.int32 array of element numbers with shape ``(n_elem,)``.
+        np.ndarray
+            Numpy.int32 array of element data with shape ``(n_elem, 10)``.
+            See :func:`DbElems.get() <ansys.mapdl.core.database.elems.DbElems.get>`
+            for the description of each field.
+        np.ndarray
+            Numpy.int64 array of offsets with shape ``(n_elem + 1,)``. The
+            nodes of element ``i`` are ``nodes[offsets[i]:offsets[i + 1]]``.
+        np.ndarray
+            Numpy.int32 array of the nodes of all the elements.
+
+        Examples
+        --------
+        Return the element numbers, data and nodes of all the elements.
+
+        >>> elems = mapdl.db.elems
+        >>> enum, elmdat, offsets, nodes = elems.all_asarray()
+        >>> enum
+        array([ 1,  2,  3, ..., 62, 63, 64], dtype=int32)
+
+        >>> elmdat[0]
+        array([ 1,  1,  1,  1,  0,  0, 14,  0,  1,  0], dtype=int32)
+
+        Nodes of the first element.
+
+        >>> nodes[offsets[0] : offsets[1]]
+        array([ 2, 27, 37,  8], dtype=int32)
+
+        """
+        mapdl = self._db._mapdl
+        mapdl._flush_batch()
+        request = anskernel.StreamRequest(chunk_size=DEFAULT_CHUNKSIZE)
+        elem_raw = parse_chunks(mapdl._stub.LoadElements(request), np.int32)
+
+        if elem_raw.size == 0:  # empty mesh
+            return (
+                np.empty(0, np.int32),
+                np.empty((0, 10), np.int32),
+                np.zeros(1, np.int64),
+                np.empty(0, np.int32),
+            )
+
+        # The stream is organized as:
+        # n_elem, offset, ..., offset, elem, elem, ..., last_elem
+        #
+        # where each element is its 10 ``elmdat`` fields followed by its
+        # nodes, and the offsets are counted from the start of the stream.
+        n_elem = elem_raw[0]
+        elem_off = elem_raw[:n_elem]
+        elem_off = elem_off[elem_off != 0].astype(np.int64) - n_elem
+        data = elem_raw[n_elem:]
+
+        heads = elem_off[:, np.newaxis] + np.arange(10)
+        elmdat = data[heads]
+
+        is_node = np.ones(data.size, np.bool_)
+        is_node[heads.ravel()] = False
+        nodes = data[is_node]
+
+        offsets = np.empty(elem_off.size + 1, np.int64)
+        offsets[0] = 0
+        np.cumsum(np.diff(elem_off, append=data.size) - 10, out=offsets[1:])
+
+        # The element number field is not filled by the stream
+        enum = mapdl.get_array("ELEM", item1="ELIST").astype(np.int32)
+        elmdat[:, 8] = enum
+
+        return enum, elmdat, offsets, nodes
+
     def push(self, ielm, elmdat, nodes):
         """
         Push an element into the database.
@@ -394,3 +482,68 @@ class DbElems:
             nodes=nodes,  # repeated int32
         )
         self._db._stub.putElm(request)
+
+    @check_mapdl_db_is_alive
+    def push_many(self, ielm, elmdat, offsets, nodes, batch_size=PUSH_BATCH_SIZE):
+        """
+        Push many elements into the database.
+
+        The elements are given in the same format returned by
+        :func:`DbElems.all_asarray()
+        <ansys.mapdl.core.database.elems.DbElems.all_asarray>`.  They are
+        sent in batches of requests without waiting for each response,
+        which is much faster than calling :func:`DbElems.push()
+        <ansys.mapdl.core.database.elems.DbElems.push>` for each element.
+
+        Parameters
+        ----------
+        ielm : numpy.ndarray
+            Element numbers with shape ``(n_elem,)``.
+        elmdat : numpy.ndarray
+            Element data with shape ``(n_elem, 10)``.
+        offsets : numpy.ndarray
+            Offsets of the nodes of each element with shape ``(n_elem + 1,)``.
+        nodes : numpy.ndarray
+            Nodes of all the elements.
+        batch_size : int, optional
+            Maximum number of requests waiting for a response.
+
+        Returns
+        -------
+        int
+            Number of elements pushed.
+
+        Examples
+        --------
+        Copy all the selected elements with their numbers offset by 1000.
+
+        >>> elems = mapdl.db.elems
+        >>> enum, elmdat, offsets, nodes = elems.all_asarray()
+        >>> elems.push_many(enum + 1000, elmdat, offsets, nodes)
+        64
+
+        """
+        ielm = np.asarray(ielm, dtype=np.int32).ravel()
+        elmdat = np.asarray(elmdat, dtype=np.int32)
+        offsets = np.asarray(offsets, dtype=np.int64).ravel()
+        nodes = np.asarray(nodes, dtype=np.int32).ravel()
+        if elmdat.shape != (ielm.size, 10):
+            raise ValueError("``elmdat`` must have shape ``(n_elem, 10)``")
+        if offsets.size != ielm.size + 1 or offsets[-1] > nodes.size:
+            raise ValueError("``offsets`` does not match the number of elements")
+
+        nodes = nodes.tolist()
+        bounds = offsets.tolist()
+
+        requests = (
+            mapdl_db_pb2.putelmRequest(
+                ielem=elem,
+                elmdat=data,
+                nnod=end - start,
+                nodes=nodes[start:end],
+            )
+            for elem, data, start, end in zip(
+                ielm.tolist(), elmdat.tolist(), bounds[:-1], bounds[1:]
+            )
+        )
+        return self._db._push_many(self._db._stub.putElm, requests, batch_size)
@@ -31,12 +31,16 @@ import weakref
 from ansys.api.mapdl.v0 import ansys_kernel_pb2 as anskernel
 from ansys.api.mapdl.v0 import mapdl_db_pb2
 import numpy as np
-from numpy.lib import recfunctions
 
 from ansys.mapdl.core.errors import MapdlRuntimeError
 
 from ..common_grpc import DEFAULT_CHUNKSIZE
-from .database import DBDef, MapdlDb, check_mapdl_db_is_alive
+from .database import PUSH_BATCH_SIZE, DBDef, MapdlDb, check_mapdl_db_is_alive
+
+# Layout of each node in the ``getAllNodC`` stream
+NODE_RECORD_DTYPE = np.dtype(
+    [("ind", np.int32), ("coord", np.double, 3), ("angle", np.double, 3)]
+)
 
 
 class DbNodes:
@@ -380,13 +384,19 @@ class DbNodes:
         return node.kerr, tuple(node.v)
 
     @check_mapdl_db_is_alive
-    def all_asarray(self):
+    def all_asarray(self, angles=True):
         """
         Return all node indices, coordinates, and angles as arrays.
 
         .. note::
            This only returns data of the selected nodes.
 
+        Parameters
+        ----------
+        angles : bool, optional
+            Return the node angles.  Set it to ``False`` to skip them
+            when only the coordinates are needed.  Defaults to ``True``.
+
         Returns
         -------
         np.ndarray
@@ -395,6 +405,7 @@ class DbNodes:
             Numpy.double array of node coordinates with shape ``(n_node, 3)``.
         np.ndarray
             Numpy.double array of node angles with shape ``(n_node, 3)``.
+            ``None`` when ``angles`` is ``False``.
 
         Examples
         --------
@@ -433,46 +444,27 @@ class DbNodes:
 
         ind = np.empty(n_nodes, np.int32)
         coord = np.empty((n_nodes, 3), np.double)
-        angle = np.empty((n_nodes, 3), np.double)
+        angle = np.empty((n_nodes, 3), np.double) if angles else None
 
         # each "chunk" from MAPDL is organized as:
         # n_nodes, node, node ... last_node
         #
         # where each node is
         # INT32, DOUBLE, DOUBLE, DOUBLE, DOUBLE, DOUBLE, DOUBLE
-
-        # first, just interpret as int32 and extract node numbering
-        # ignore the first int as this is n_nodes
-        # data = parse_chunks(chunks, np.int32)
+        #
+        # The fields of the structured view over the payload are copied
+        # directly into the output arrays, without intermediate arrays.
         c = 0
         for chunk in chunks:
-            parsed_chunk = np.frombuffer(chunk.payload, np.int32)
-            n_node = parsed_chunk[0]
-            data = parsed_chunk[1:].view(
-                [
-                    ("ind", np.int32),
-                    ("x", np.double),
-                    ("y", np.double),
-                    ("z", np.double),
-                    ("xang", np.double),
-                    ("yang", np.double),
-                    ("zang", np.double),
-                ]
+            n_node = int(np.frombuffer(chunk.payload, np.int32, count=1)[0])
+            data = np.frombuffer(
+                chunk.payload, NODE_RECORD_DTYPE, count=n_node, offset=4
             )
 
-            ind_chunk = recfunctions.structured_to_unstructured(data[["ind"]]).ravel()
-
-            coord_chunk = recfunctions.structured_to_unstructured(
-                data[["x", "y", "z"]]
-            ).reshape((-1, 3))
-
-            angle_chunk = recfunctions.structured_to_unstructured(
-                data[["xang", "yang", "zang"]]
-            ).reshape((-1, 3))
-
-            ind[c : c + n_node] = ind_chunk
-            coord[c : c + n_node] = coord_chunk
-            angle[c : c + n_node] = angle_chunk
+            ind[c : c + n_node] = data["ind"]
+            coord[c : c + n_node] = data["coord"]
+            if angles:
+                angle[c : c + n_node] = data["angle"]
             c += n_node
 
         return ind, coord, angle
@@ -528,6 +520,59 @@ class DbNodes:
 
         self._db._stub.putNod(request)
 
+    @check_mapdl_db_is_alive
+    def push_many(self, inod, xyz, angles=None, batch_size=PUSH_BATCH_SIZE):
+        """
+        Push many nodes into the DB.
+
+        The nodes are sent in batches of requests without waiting for
+        each response, which is much faster than calling
+        :func:`DbNodes.push() <ansys.mapdl.core.database.nodes.DbNodes.push>`
+        for each node.
+
+        Parameters
+        ----------
+        inod : numpy.ndarray
+            Node numbers with shape ``(n_node,)``.
+        xyz : numpy.ndarray
+            Node coordinates with shape ``(n_node, 3)``.
+        angles : numpy.ndarray, optional
+            Node angles with shape ``(n_node, 3)``.
+        batch_size : int, optional
+            Maximum number of requests waiting for a response.
+
+        Returns
+        -------
+        int
+            Number of nodes pushed.
+
+        Examples
+        --------
+        Translate all the selected nodes by ``(1.0, 0.0, 0.0)``.
+
+        >>> nodes = mapdl.db.nodes
+        >>> ind, coords, _ = nodes.all_asarray(angles=False)
+        >>> nodes.push_many(ind, coords + [1.0, 0.0, 0.0])
+        425
+
+        """
+        inod = np.asarray(inod, dtype=np.int32).ravel()
+        vctn = np.asarray(xyz, dtype=np.double)
+        if vctn.shape != (inod.size, 3):
+            raise ValueError("``xyz`` must have shape ``(n_node, 3)``")
+
+        if angles is not None:
+            angles = np.asarray(angles, dtype=np.double)
+            if angles.shape != (inod.size, 3):
+                raise ValueError("``angles`` must have shape ``(n_node, 3)``")
+            vctn = np.hstack((vctn, angles))
+
+        requests = (
+            mapdl_db_pb2.putnodRequest(node=node, vctn=values)
+            for node, values in zip(inod.tolist(), vctn.tolist())
+        )
+        return self._db._push_many(self._db._stub.putNod, requests, batch_size)
+
     ###############################################################################
     # unimplemented
 
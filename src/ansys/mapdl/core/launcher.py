@@ -32,7 +32,7 @@ import subprocess
 import tempfile
 import threading
 import time
-from typing import TYPE_CHECKING, Dict, List, Optional, Tuple, Union
+from typing import TYPE_CHECKING, Any, Dict, List, Optional, Tuple, Union
 import warnings
 
 import psutil
@@ -276,6 +276,122 @@ def port_in_use_using_psutil(port: Union[int, str]) -> bool:
         return False
 
 
+class PortReservation:
+    """Hold a port by keeping a socket bound to it.
+
+    While the reservation is held, no other process can bind the port.
+    Release it right before launching MAPDL on the port.  Another process
+    can still take the port between the release and the start of MAPDL,
+    which :func:`launch_grpc` detects when it checks the port again.
+
+    Parameters
+    ----------
+    port : int
+        Port to reserve.
+
+    host : str, optional
+        Address to bind to. Defaults to ``"127.0.0.1"``.
+
+    Raises
+    ------
+    OSError
+        If the port is already in use.
+    """
+
+    def __init__(self, port: int, host: str = LOCALHOST):
+        self.port = port
+        self._socket = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        try:
+            self._socket.bind((host, port))
+        except OSError:
+            self._socket.close()
+            self._socket = None
+            raise
+
+    def __repr__(self):
+        state = "held" if self.held else "released"
+        return f"<PortReservation port={self.port} ({state})>"
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.release()
+
+    @property
+    def held(self) -> bool:
+        """Whether the port is still reserved."""
+        return self._socket is not None
+
+    def release(self) -> int:
+        """Release the port so MAPDL can use it.
+
+        Returns
+        -------
+        int
+            The released port.
+        """
+        if self._socket is not None:
+            self._socket.close()
+            self._socket = None
+        return self.port
+
+
+def reserve_ports(
+    n_ports: int, starting_port: int = MAPDL_DEFAULT_PORT, host: str = LOCALHOST
+) -> List[PortReservation]:
+    """Reserve the first ``n_ports`` free ports starting from ``starting_port``.
+
+    Each port is bound (and held) as soon as it is found free, so other
+    processes cannot take it while the rest of the ports are searched and
+    the instances are prepared.  Release each reservation right before
+    launching MAPDL on its port.  This shortens, but does not remove, the
+    window where another process can take the port.
+
+    Parameters
+    ----------
+    n_ports : int
+        Number of ports to reserve.
+
+    starting_port : int, optional
+        First port to try. Defaults to ``50052``.
+
+    host : str, optional
+        Address to bind to. Defaults to ``"127.0.0.1"``.
+
+    Returns
+    -------
+    list[PortReservation]
+        Reserved ports.
+
+    Examples
+    --------
+    >>> from ansys.mapdl.core.launcher import launch_mapdl, reserve_ports
+    >>> reservations = reserve_ports(2)
+    >>> port = reservations[0].release()
+    >>> mapdl = launch_mapdl(port=port)
+    """
+    reservations: List[PortReservation] = []
+    port = starting_port
+    while port < 65536 and len(reservations) < n_ports:
+        if port not in pymapdl._LOCAL_PORTS:
+            try:
+                reservations.append(PortReservation(port, host))
+            except OSError:
+                LOG.debug(f"Port {port} in use. Trying next port.")
+        port += 1
+
+    if len(reservations) < n_ports:
+        for reservation in reservations:
+            reservation.release()
+        raise MapdlRuntimeError(
+            f"There are not {n_ports} available ports between {starting_port} and 65536"
+        )
+
+    LOG.debug(f"Reserved ports: {[each.port for each in reservations]}")
+    return reservations
+
+
 def launch_grpc(
     exec_file: str = "",
     jobname: str = "file",
@@ -1082,6 +1198,7 @@ def launch_mapdl(
     add_env_vars: Optional[Dict[str, str]] = None,
     replace_env_vars: Optional[Dict[str, str]] = None,
     version: Optional[Union[int, str]] = None,
+    prewarmed: bool = False,
     **kwargs,
 ) -> Union[MapdlGrpc, "MapdlConsole"]:
     """Start MAPDL locally.
@@ -1267,6 +1384,15 @@ def launch_mapdl(
 
               export PYMAPDL_MAPDL_VERSION=22.2
 
+    prewarmed : bool, optional
+        Use an instance from the running warm pool instead of launching a
+        new one.  The warm pool keeps instances launched in the background,
+        so the instance is available almost immediately.  Start the warm
+        pool with ``pymapdl start --prewarm N``.  If there is no warm pool
+        running or it has no ready instances, a new instance is launched
+        as usual.  Defaults to ``False``.  See
+        :mod:`ansys.mapdl.core.warm_pool`.
+
     kwargs : dict, optional
         These keyword arguments are interface specific or for
         development purposes. See Notes for more details.
@@ -1611,6 +1737,28 @@ def launch_mapdl(
             else:
                 LOG.debug("Bypassing Gallery building flag for the first time.")
 
+        if prewarmed and not just_launch and not _debug_no_launch:
+            mapdl = _connect_to_warm_instance(
+                launch_kwargs={
+                    "exec_file": exec_file,
+                    "version": version,
+                    "nproc": nproc,
+                    "ram": ram,
+                    "jobname": jobname,
+                    "run_location": run_location,
+                    "additional_switches": additional_switches,
+                },
+                cleanup_on_exit=cleanup_on_exit,
+                loglevel=loglevel,
+                set_no_abort=set_no_abort,
+                remove_temp_dir_on_exit=remove_temp_dir_on_exit,
+                log_apdl=log_apdl,
+                use_vtk=use_vtk,
+                **start_parm,
+            )
+            if mapdl is not None:
+                return mapdl
+
     else:
         LOG.debug("Connecting to an existing instance of MAPDL at %s:%s", ip, port)
 
@@ -1788,12 +1936,14 @@ def launch_mapdl(
                     version,
                 )
 
+            tstart = time.time()
             port, actual_run_location, process = launch_grpc(
                 port=port,
                 add_env_vars=add_env_vars,
                 replace_env_vars=replace_env_vars,
                 **start_parm,
             )
+            startup_timings = {"launch": time.time() - tstart}
 
             if just_launch:
                 out = [ip, port]
@@ -1813,6 +1963,10 @@ def launch_mapdl(
                 use_vtk=use_vtk,
                 **start_parm,
             )
+            startup_timings["connect"] = (
+                time.time() - tstart - startup_timings["launch"]
+            )
+            mapdl._startup_timings.update(startup_timings)
             if run_location is None:
                 mapdl._path = actual_run_location
 
@@ -1836,6 +1990,134 @@ def launch_mapdl(
     return mapdl
 
 
+def _connect_to_warm_instance(
+    launch_kwargs: Optional[Dict[str, Any]] = None, **kwargs
+) -> Optional[MapdlGrpc]:
+    """Connect to an instance handed over by the running warm pool.
+
+    Returns ``None`` when no warm pool is running, it has no ready
+    instances or its instances were launched with different
+    ``launch_kwargs``, so the caller falls back to a normal launch.
+    """
+    # lazy import to avoid circular import
+    from ansys.mapdl.core.warm_pool import acquire_warm_instance
+
+    instance = acquire_warm_instance(launch_kwargs=launch_kwargs)
+    if instance is None:
+        LOG.info("No prewarmed MAPDL instance available. Launching a new one.")
+        return None
+
+    LOG.debug(
+        "Using the prewarmed MAPDL instance at %s:%s (PID=%s).",
+        instance["ip"],
+        instance["port"],
+        instance["pid"],
+    )
+    mapdl = MapdlGrpc(ip=instance["ip"], port=instance["port"], **kwargs)
+    mapdl._path = instance["directory"]
+    mapdl._launched_pid = instance["pid"]
+    mapdl._launched = True
+    mapdl._cache_pids()
+    return mapdl
+
+
+def launch_mapdl_instances(
+    n_instances: int,
+    starting_port: int = MAPDL_DEFAULT_PORT,
+    run_location: Optional[str] = None,
+    **kwargs,
+) -> List[MapdlGrpc]:
+    """Launch several local MAPDL instances concurrently.
+
+    The ports are reserved at once with :func:`reserve_ports` and each port
+    is held until right before its instance is launched, so other processes
+    are unlikely to take it in the meantime.  All the instances are launched
+    at the same time, hence the launch time does not grow with the number of
+    instances.
+
+    The time spent in each startup phase is available in
+    :attr:`Mapdl.startup_timings <ansys.mapdl.core.mapdl_grpc.MapdlGrpc.startup_timings>`.
+
+    Parameters
+    ----------
+    n_instances : int
+        Number of instances to launch.
+
+    starting_port : int, optional
+        First port to try. Defaults to ``50052``.
+
+    run_location : str, optional
+        Base directory where a working directory is created for each
+        instance. Defaults to a temporary working directory for each
+        instance.
+
+    **kwargs : dict, optional
+        Arguments given to :func:`launch_mapdl` to launch each instance.
+
+    Returns
+    -------
+    list[MapdlGrpc]
+        Launched instances.
+
+    Examples
+    --------
+    >>> from ansys.mapdl.core.launcher import launch_mapdl_instances
+    >>> instances = launch_mapdl_instances(4, nproc=1)
+    >>> instances[0].startup_timings
+    {'port_reservation': 0.002, 'launch': 7.1, 'connect': 0.4}
+    """
+    if n_instances < 1:
+        raise ValueError("Must request at least 1 instance.")
+
+    for each_arg in ["port", "ip", "start_instance", "just_launch"]:
+        if each_arg in kwargs:
+            raise ValueError(
+                f"The argument '{each_arg}' cannot be used with 'launch_mapdl_instances'."
+            )
+
+    tstart = time.time()
+    reservations = reserve_ports(n_instances, starting_port)
+    reservation_time = time.time() - tstart
+
+    instances: List[Optional[MapdlGrpc]] = [None for _ in range(n_instances)]
+    errors: List[Exception] = []
+
+    def launch(index: int, reservation: PortReservation):
+        try:
+            directory = create_temp_dir(run_location) if run_location else None
+            mapdl = launch_mapdl(
+                port=reservation.release(),
+                run_location=directory,
+                start_instance=True,
+                **kwargs,
+            )
+            mapdl._startup_timings["port_reservation"] = reservation_time
+            instances[index] = mapdl
+        except Exception as error:
+            reservation.release()
+            errors.append(error)
+
+    threads = [
+        threading.Thread(
+            target=launch, args=(i, reservation), name=f"Launching_MAPDL_{i}"
+        )
+        for i, reservation in enumerate(reservations)
+    ]
+    [thread.start() for thread in threads]
+    [thread.join() for thread in threads]
+
+    if errors:
+        for mapdl in instances:
+            if mapdl is not None:
+                mapdl.exit()
+        raise errors[0]
+
+    LOG.debug(
+        f"Launched {n_instances} MAPDL instances in {time.time() - tstart:.2f} seconds."
+    )
+    return instances
+
+
 def check_mode(mode, version):
     """Check if the MAPDL server mode matches the allowable version
 
@@ -86,6 +86,7 @@ if _HAS_PYVISTA:
     from ansys.mapdl.core.plotting import get_meshes_from_plotter
 
 from ansys.mapdl.core.post import PostProcessing
+from ansys.mapdl.core.profiler import CommandProfiler, profile_command
 
 DEBUG_LEVELS = Literal["DEBUG", "INFO", "WARNING", "ERROR"]
 
@@ -196,6 +197,8 @@ def setup_logger(loglevel="INFO", log_file=True, mapdl_instance=None):
 
 _ALLOWED_START_PARM = [
     "additional_switches",
+    "chunk_size",
+    "compression",
     "exec_file",
     "ip",
     "jobname",
@@ -252,6 +255,7 @@ class _MapdlCore(Commands):
         self._file_type_for_plots = file_type_for_plots
         self._default_file_type_for_plots = file_type_for_plots
         self._version = None  # cached version
+        self._profiler: Optional[CommandProfiler] = None
 
         if _HAS_PYVISTA:
             if use_vtk is not None:  # pragma: no cover
@@ -1225,6 +1229,10 @@ class _MapdlCore(Commands):
 
             @wraps(func)
             def inner_wrapper(*args, **kwargs):
+                if kwargs.pop("binary", False):
+                    output = self._binary_listing(func, *args, **kwargs)
+                    if output is not None:
+                        return output
                 return CommandListingOutput(func(*args, **kwargs))
 
             return inner_wrapper
@@ -1253,6 +1261,14 @@ class _MapdlCore(Commands):
                 func = self.__getattribute__(name)
                 setattr(self, name, wrap_bc_listing_function(func))
 
+    def _binary_listing(self, func, *args, **kwargs):
+        """Fetch the table of a listing command without formatting it as text.
+
+        Only supported by the gRPC interface.  Returns ``None`` when the
+        listing must be obtained by running the command.
+        """
+        return None
+
     def _wrap_xsel_commands(self):
         # Wrapping XSEL commands.
         def wrap_xsel_function(func):
@@ -1506,7 +1522,7 @@ class _MapdlCore(Commands):
 
             return Geometry(self)
 
-    def _reset_cache(self):
+    def _reset_cache(self, command=None):
         """Reset cached items"""
         self._archive_cache = None
 
@@ -2040,6 +2056,7 @@ class _MapdlCore(Commands):
             self._flush_stored()
             return self._response
 
+    @profile_command
     def run(
         self,
         command: str,
@@ -2076,6 +2093,18 @@ class _MapdlCore(Commands):
               Prints the command to the screen before running it.
               Defaults to ``False``.
 
+            on_output : :class:`Callable`
+              *(gRPC only)*
+              Function called with each piece of the command output while
+              the command is running, for example to follow a long
+              ``SOLVE``. Only the last megabyte of output is kept to be
+              returned.
+
+            stream_period : :class:`int`
+              *(gRPC only)*
+              Period, in milliseconds, at which the output is streamed to
+              ``on_output``. Defaults to ``100``.
+
         Returns
         -------
         str
@@ -2101,6 +2130,10 @@ class _MapdlCore(Commands):
         --------
         >>> mapdl.run('/PREP7')
 
+        Follow the output of a solution while it is running.
+
+        >>> mapdl.run("SOLVE", on_output=lambda text: print(text, end=""))
+
         Equivalent Pythonic method:
 
         >>> mapdl.prep7()
@@ -2114,6 +2147,18 @@ class _MapdlCore(Commands):
         verbose = kwargs.pop("verbose", False)
         save_fig = kwargs.pop("savefig", False)
 
+        # Streaming the output to a callback
+        stream_kwargs = {}
+        for key in ["on_output", "stream_period"]:
+            value = kwargs.pop(key, None)
+            if value is not None:
+                stream_kwargs[key] = value
+        if stream_kwargs and not self.is_grpc:
+            raise ValueError(
+                "The arguments 'on_output' and 'stream_period' are only "
+                "supported by the gRPC interface."
+            )
+
         # Check if you want to avoid the current non-interactive context.
         avoid_non_interactive = kwargs.pop("avoid_non_interactive", False)
 
@@ -2140,6 +2185,9 @@ class _MapdlCore(Commands):
             return
 
         # Actually sending the message
+        if self.is_grpc:
+            self._check_no_solve_running()
+
         if self._session_id is not None:
             self._check_session_id()
         else:
@@ -2156,7 +2204,7 @@ class _MapdlCore(Commands):
         command = command.strip()
 
         # always reset the cache
-        self._reset_cache()
+        self._reset_cache(command)
 
         # address MAPDL /INPUT level issue
         if command[:4].upper() == "/CLE":
@@ -2209,7 +2257,7 @@ class _MapdlCore(Commands):
                 self._check_parameter_name(param_name)
 
         short_cmd = parse_to_short_cmd(command)
-        text = self._run(command, verbose=verbose, mute=mute)
+        text = self._run(command, verbose=verbose, mute=mute, **stream_kwargs)
 
         if (
             "Display device has not yet been specified with the /SHOW command" in text
@@ -2217,7 +2265,7 @@ class _MapdlCore(Commands):
         ):
             # Reissuing the command to make sure we get output.
             self.show(self.default_file_type_for_plots)
-            text = self._run(command, verbose=verbose, mute=mute)
+            text = self._run(command, verbose=verbose, mute=mute, **stream_kwargs)
 
         if command[:4].upper() == "/CLE" and self.is_grpc:
             # We have reset the database, so we need to create a new session id
@@ -2226,6 +2274,10 @@ class _MapdlCore(Commands):
         if mute:
             return
 
+        profiler = self._profiler
+        if profiler is not None:
+            tparse = time.perf_counter()
+
         text = text.replace("\\r\\n", "\n").replace("\\n", "\n")
         if text:
             self._response = StringWithLiteralRepr(text.strip())
@@ -2237,6 +2289,9 @@ class _MapdlCore(Commands):
         if not self.ignore_errors:
             self._raise_errors(text)
 
+        if profiler is not None:
+            profiler._span("parse", tparse, time.perf_counter())
+
         # special returns for certain geometry commands
         if short_cmd in PLOT_COMMANDS:
             self._log.debug("It is a plot command.")
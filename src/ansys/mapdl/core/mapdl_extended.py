@@ -1219,8 +1219,13 @@ class _MapdlCommandExtended(_MapdlCore):
                 warnings.warn("There are no elements to plot.")
                 return general_plotter([], [], [], mapdl=self, **kwargs)
 
-            # TODO: Consider caching the surface
-            esurf = self.mesh._grid.linear_copy().extract_surface().clean()
+            # The gRPC mesh keeps the surface until the mesh changes.  The
+            # plotter gets a shallow copy, so it cannot alter the cached one.
+            esurf = getattr(self.mesh, "_linear_surf", None)
+            if esurf is not None:
+                esurf = esurf.copy(deep=False)
+            else:
+                esurf = self.mesh._grid.linear_copy().extract_surface().clean()
             kwargs.setdefault("show_edges", True)
 
             # if show_node_numbering:
@@ -1428,6 +1433,7 @@ class _MapdlCommandExtended(_MapdlCore):
         REMOVE_LINES = ("/OUT", "/OUT,anstmp")
         REMOVE_LINES_STARTING = (
             "*SET,__PYMAPDL_SESSION_ID__",
+            "*SET,__PYMAPDL_SESSION_KEY__",
             "! *STATUS,__PYMAPDL_SESSION_ID__",
             "*STATUS,__PYMAPDL_SESSION_ID__",
         )
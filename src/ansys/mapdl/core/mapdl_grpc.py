@@ -22,9 +22,12 @@
 
 """A gRPC specific class and methods for the MAPDL gRPC client """
 
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor, as_completed
 import fnmatch
 from functools import wraps
 import glob
+import inspect
 import io
 import os
 import pathlib
@@ -34,10 +37,21 @@ from subprocess import Popen
 import tempfile
 import threading
 import time
-from typing import TYPE_CHECKING, List, Literal, Optional, Tuple, Union
+from typing import (
+    TYPE_CHECKING,
+    Any,
+    Callable,
+    Dict,
+    List,
+    Literal,
+    Optional,
+    Tuple,
+    Union,
+)
 from uuid import uuid4
 from warnings import warn
 import weakref
+import zlib
 
 from ansys.tools.versioning.utils import version_string_as_tuple
 import grpc
@@ -64,30 +78,42 @@ except ImportError:  # pragma: no cover
     raise ImportError(MSG_IMPORT)
 
 from ansys.mapdl.core import _LOCAL_PORTS, __version__
+from ansys.mapdl.core.commands import (
+    NLIST_BINARY_COLUMNS,
+    PRNSOL_BINARY_ITEMS,
+    PRNSOL_ELEMENT_ITEMS,
+    BinaryListingOutput,
+)
 from ansys.mapdl.core.common_grpc import (
     ANSYS_VALUE_TYPE,
     DEFAULT_CHUNKSIZE,
     DEFAULT_FILE_CHUNK_SIZE,
+    AdaptiveChunkSize,
     parse_chunks,
 )
 from ansys.mapdl.core.errors import (
     MapdlConnectionError,
     MapdlError,
+    MapdlException,
     MapdlExitedError,
     MapdlRuntimeError,
     protect_from,
     protect_grpc,
 )
 from ansys.mapdl.core.mapdl import MapdlBase
+from ansys.mapdl.core.mapdl_core import PLOT_COMMANDS
 from ansys.mapdl.core.mapdl_types import KwargDict, MapdlFloat, MapdlInt
 from ansys.mapdl.core.misc import (
     check_valid_ip,
+    file_checksum,
     last_created,
     random_string,
     run_as_prep7,
     supress_logging,
 )
 from ansys.mapdl.core.parameters import interp_star_status
+from ansys.mapdl.core.profiler import CommandProfiler
+from ansys.mapdl.core.solution import SolveHandle
 
 # Checking if tqdm is installed.
 # If it is, the default value for progress_bar is true.
@@ -117,11 +143,69 @@ VAR_IR = 9  # Default variable number for automatic variable retrieving (/post26
 
 SESSION_ID_NAME = "__PYMAPDL_SESSION_ID__"
 
+# Numeric key derived from the session ID. Being numeric, it can be read
+# with a single binary ``GetParameter`` request instead of parsing the
+# ``*STATUS`` output of the session ID string.
+SESSION_KEY_NAME = "__PYMAPDL_SESSION_KEY__"
+
+# Minimum time in seconds between two session ID checks.  A session taken
+# over by another client within this time is only detected by the next
+# check.
+SESSION_CHECK_INTERVAL = 1.0
+
+# Number of files downloaded at the same time
+DOWNLOAD_MAX_WORKERS = 4
+
+# Number of times an interrupted download is restarted before giving up
+DOWNLOAD_RETRIES = 3
+
+# Suffix of the file written next to a file uploaded with ``use_cache=True``.
+# It records the digest of the uploaded content and the remote fingerprint
+# right after the upload, so later sessions can reuse the remote copy.
+UPLOAD_RECORD_SUFFIX = ".pymapdl_upload"
+
+# Comment written before each command flushed in batching mode, so the
+# output can be split to find the command which raised an error.
+BATCH_MARKER = "__PYMAPDL_BATCH_{}__"
+BATCH_MARKER_PATTERN = re.compile(r"__PYMAPDL_BATCH_(\d+)__")
+
+# Commands which are not batched because their output is the result, they
+# change the output redirection or they reset the session.
+NOT_BATCHED_COMMANDS = ("*STA", "/STA", "*GET", "/INQ", "/OUT", "/CLE", "/EXI", "/LIS")
+
+# Default period, in milliseconds, at which the streamed command output is sent
+STREAM_PERIOD = 100
+
+# Maximum number of characters of streamed output kept in memory when the
+# output is delivered to a callback. Older output is dropped.
+STREAM_MAX_OUTPUT = 1024**2
+
+# Compression algorithms for the requests sent through the channel
+GRPC_COMPRESSION = {
+    "gzip": grpc.Compression.Gzip,
+    "deflate": grpc.Compression.Deflate,
+}
+
+# Connectivity states that indicate the server might not be reachable anymore
+UNHEALTHY_CHANNEL_STATES = (
+    grpc.ChannelConnectivity.TRANSIENT_FAILURE,
+    grpc.ChannelConnectivity.SHUTDOWN,
+)
+
+
+def _session_key(session_id: str) -> int:
+    """Return the numeric key of a session ID.
 
-def chunk_raw(raw, save_as):
+    The CRC32 fits in 32 bits, so it is stored exactly in a MAPDL
+    parameter.
+    """
+    return zlib.crc32(session_id.encode())
+
+
+def chunk_raw(raw, save_as, chunk_size=DEFAULT_FILE_CHUNK_SIZE):
     with io.BytesIO(raw) as f:
         while True:
-            piece = f.read(DEFAULT_FILE_CHUNK_SIZE)
+            piece = f.read(chunk_size)
             length = len(piece)
             if length == 0:
                 return
@@ -131,7 +215,7 @@ def chunk_raw(raw, save_as):
             )
 
 
-def get_file_chunks(filename, progress_bar=False):
+def get_file_chunks(filename, progress_bar=False, chunk_size=DEFAULT_FILE_CHUNK_SIZE):
     """Serializes a file into chunks"""
     pbar = None
     if progress_bar:
@@ -155,7 +239,7 @@ def get_file_chunks(filename, progress_bar=False):
 
     with open(filename, "rb") as f:
         while True:
-            piece = f.read(DEFAULT_FILE_CHUNK_SIZE)
+            piece = f.read(chunk_size)
             length = len(piece)
             if length == 0:
                 if pbar is not None:
@@ -171,42 +255,59 @@ def get_file_chunks(filename, progress_bar=False):
             )
 
 
+def _download_progress_bar(desc, total=None):
+    """Create a ``tqdm`` progress bar reporting the downloaded bytes and the
+    throughput."""
+    if not _HAS_TQDM:  # pragma: no cover
+        raise ModuleNotFoundError(
+            f"To use the keyword argument 'progress_bar', you need to have installed the 'tqdm' package."
+            "To avoid this message you can set 'progress_bar=False'."
+        )
+
+    return tqdm(
+        total=total,
+        desc=desc,
+        unit="B",
+        unit_scale=True,
+        unit_divisor=1024,
+    )
+
+
 def save_chunks_to_file(
-    chunks, filename, progress_bar=False, file_size=None, target_name=""
+    chunks,
+    filename,
+    progress_bar=False,
+    file_size=None,
+    target_name="",
+    pbar=None,
 ):
     """Saves chunks to a local file
 
+    Parameters
+    ----------
+    pbar : tqdm.tqdm, optional
+        Existing progress bar to update. It is not closed.
+
     Returns
     -------
     file_size : int
         File size saved in bytes.  ``0`` means no file was written.
     """
-    pbar = None
-    if progress_bar:
-        if not _HAS_TQDM:  # pragma: no cover
-            raise ModuleNotFoundError(
-                f"To use the keyword argument 'progress_bar', you need to have installed the 'tqdm' package."
-                "To avoid this message you can set 'progress_bar=False'."
-            )
-
-        pbar = tqdm(
-            total=file_size,
-            desc="Downloading %s" % target_name,
-            unit="B",
-            unit_scale=True,
-            unit_divisor=1024,
-        )
+    own_pbar = False
+    if progress_bar and pbar is None:
+        pbar = _download_progress_bar("Downloading %s" % target_name, file_size)
+        own_pbar = True
 
     file_size = 0
     with open(filename, "wb") as f:
         for chunk in chunks:
             f.write(chunk.payload)
-            payload_size = len(chunk.payload)
-            file_size += payload_size
+            file_size += len(chunk.payload)
+
             if pbar is not None:
-                pbar.update(payload_size)
+                pbar.update(len(chunk.payload))
 
-    if pbar is not None:
+    if own_pbar:
         pbar.close()
 
     return file_size
@@ -271,6 +372,24 @@ class MapdlGrpc(MapdlBase):
         Change the default file type for plots using ``/SHOW``, by
         default it is ``PNG``.
 
+    compression : str, optional
+        Compression algorithm, ``"gzip"`` or ``"deflate"``, for the
+        requests sent to the MAPDL instance, for example the uploaded files.
+        Compression reduces the transfer time on slow links, such as
+        remote clusters, at the cost of CPU time. Only the messages sent
+        by the client are compressed. The responses of the MAPDL instance,
+        for example the downloaded files, are compressed only if the
+        server is configured to do so. It is ignored if ``channel`` is
+        given. The default is ``None``, which does not compress.
+
+    chunk_size : int or str, optional
+        Size in bytes of the chunks used to upload and download files. If
+        ``"auto"``, the size follows the throughput measured in the
+        previous transfers, between 64 kB and 2 MB. An integer must not be
+        larger than the 4 MB limit of the gRPC messages. The default is
+        ``None``, in which case 256 kB chunks are used for the downloads
+        and 1 MB chunks for the uploads.
+
 
     Examples
     --------
@@ -323,6 +442,8 @@ class MapdlGrpc(MapdlBase):
         disable_run_at_connect: bool = False,
         channel: Optional[grpc.Channel] = None,
         remote_instance: Optional["PIM_Instance"] = None,
+        compression: Optional[Literal["gzip", "deflate"]] = None,
+        chunk_size: Optional[Union[int, Literal["auto"]]] = None,
         **start_parm,
     ):
         """Initialize connection to the mapdl server"""
@@ -343,12 +464,37 @@ class MapdlGrpc(MapdlBase):
         self._strict_session_id_check: bool = (
             False  # bool to force to check the session id matches in client and server
         )
+        self._session_check_interval: float = SESSION_CHECK_INTERVAL
+        self._last_session_check: float = 0.0
 
         if channel is not None:
             if ip is not None or port is not None:
                 raise ValueError(
                     "If `channel` is specified, neither `port` nor `ip` can be specified."
                 )
+
+        if compression is not None and compression not in GRPC_COMPRESSION:
+            raise ValueError(
+                f"The compression '{compression}' is not supported. "
+                f"Use one of: {', '.join(GRPC_COMPRESSION)}."
+            )
+        self._compression: Optional[str] = compression
+
+        if chunk_size == "auto":
+            self._adaptive_chunk_size: Optional[AdaptiveChunkSize] = AdaptiveChunkSize()
+        elif chunk_size is None or isinstance(chunk_size, int):
+            self._adaptive_chunk_size = None
+        else:
+            raise ValueError("The argument 'chunk_size' must be an integer or 'auto'.")
+
+        if isinstance(chunk_size, int) and not 0 < chunk_size <= 4 * 1024 * 1024:
+            raise ValueError(
+                "The argument 'chunk_size' must be a positive number of bytes "
+                "not larger than 4 MB, which is the gRPC message size limit."
+            )
+        self._chunk_size: Optional[int] = (
+            chunk_size if isinstance(chunk_size, int) else None
+        )
         if ip is None:
             ip = "127.0.0.1"
 
@@ -373,11 +519,18 @@ class MapdlGrpc(MapdlBase):
         )
         self._mode: Literal["grpc"] = "grpc"
 
+        # Automatic command batching. See ``MapdlGrpc.batching``
+        self._batching: bool = False
+        self._batch: List[str] = []
+        self._flushing_batch: bool = False
+
         # gRPC request specific locks as these gRPC request are not thread safe
         self._vget_lock: bool = False
         self._get_lock: bool = False
 
         self._prioritize_thermal: bool = False
+        self._sync_lock = threading.Lock()
+        self._solve_handle: Optional[SolveHandle] = None  # See ``solve_async``
         self._locked: bool = False  # being used within MapdlPool
         self._stub: Optional[mapdl_grpc.MapdlServiceStub] = None
         self._cleanup: bool = cleanup_on_exit
@@ -397,6 +550,12 @@ class MapdlGrpc(MapdlBase):
         self._state: Optional[grpc.Future] = None
         self._timeout: int = timeout
         self._pids: List[Union[int, None]] = []
+        self._launched_pid: Optional[int] = None
+        self._startup_timings: Dict[str, float] = {}
+        self._channel_state: Optional[grpc.ChannelConnectivity] = None
+        self._channel_state_callback: Optional[Callable] = None
+        self._health_callbacks: List[Callable[["MapdlGrpc"], None]] = []
+        self._heartbeat_stop: threading.Event = threading.Event()
 
         if channel is None:
             self._log.debug("Creating channel to %s:%s", ip, port)
@@ -485,8 +644,27 @@ class MapdlGrpc(MapdlBase):
             options=[
                 ("grpc.max_receive_message_length", MAX_MESSAGE_LENGTH),
             ],
+            compression=GRPC_COMPRESSION.get(self._compression),
         )
 
+    def _get_chunk_size(self, default: int) -> int:
+        """Chunk size for the next file transfer.
+
+        Parameters
+        ----------
+        default : int
+            Chunk size used when ``chunk_size`` was not given at
+            initialization.
+        """
+        if self._adaptive_chunk_size is not None:
+            return self._adaptive_chunk_size.size
+        return self._chunk_size or default
+
+    def _record_transfer(self, n_bytes: int, elapsed: float) -> None:
+        """Feed the adaptive chunk size with a finished file transfer."""
+        if self._adaptive_chunk_size is not None:
+            self._adaptive_chunk_size.record(n_bytes, elapsed)
+
     def _multi_connect(self, n_attempts=5, timeout=15):
         """Try to connect over a series of attempts to the channel.
 
@@ -749,7 +927,7 @@ class MapdlGrpc(MapdlBase):
 
         # keeps mapdl session alive
         self._timer = None
-        if not self._local:
+        if not self._local and not self._heartbeat_stop.is_set():
             self._initialised = threading.Event()
             self._t_trigger = time.time()
             self._t_delay = 30
@@ -807,6 +985,7 @@ class MapdlGrpc(MapdlBase):
         from ansys.mapdl.core.launcher import launch_grpc
 
         self._exited = False  # reset exit state
+        self._heartbeat_stop.clear()
         port, directory, process = launch_grpc(**start_parm)
         self._connect(port)
 
@@ -839,10 +1018,13 @@ class MapdlGrpc(MapdlBase):
         self.version  # Caching version
         self.file_type_for_plots  # Setting /show,png and caching it.
 
-    def _reset_cache(self):
-        """Reset cached items."""
+    def _reset_cache(self, command=None):
+        """Reset cached items.
+
+        ``command`` is the command about to be run, if any.
+        """
         if self._mesh_rep is not None:
-            self._mesh_rep._reset_cache()
+            self._mesh_rep._reset_cache(command)
 
         if self._geometry is not None:
             self._geometry._reset_cache()
@@ -851,7 +1033,14 @@ class MapdlGrpc(MapdlBase):
     def _mesh(self):
         return self._mesh_rep
 
-    def _run(self, cmd: str, verbose: bool = False, mute: Optional[bool] = None) -> str:
+    def _run(
+        self,
+        cmd: str,
+        verbose: bool = False,
+        mute: Optional[bool] = None,
+        on_output: Optional[Callable[[str], None]] = None,
+        stream_period: int = STREAM_PERIOD,
+    ) -> str:
         """Sens a command and return the response as a string.
 
         Parameters
@@ -867,6 +1056,15 @@ class MapdlGrpc(MapdlBase):
             is ``None``, in which case the global setting specified by
             ``mapdl.mute = <bool>`` is used, which is ``False`` by default.
 
+        on_output : callable, optional
+            Function called with each piece of the output while the command
+            is running. Only the last ``STREAM_MAX_OUTPUT`` characters of
+            the output are returned.
+
+        stream_period : int, optional
+            Period, in milliseconds, at which the output is streamed when
+            ``verbose`` or ``on_output`` are used. The default is ``100``.
+
         Examples
         --------
         Run a basic command.
@@ -897,12 +1095,39 @@ class MapdlGrpc(MapdlBase):
         if len(cmd) > 639:  # CMD_MAX_LENGTH
             raise ValueError("Maximum command length must be less than 640 characters")
 
+        self._check_no_solve_running()
+
+        if (
+            self._batching
+            and not self._flushing_batch
+            and not verbose
+            and on_output is None
+            and self._is_batchable(cmd)
+        ):
+            # Empty output, so ``Mapdl.run`` returns ``None``
+            self._batch.append(cmd)
+            return ""
+
+        # The command might depend on the queued ones
+        self._flush_batch()
+
+        profiler = self._profiler
+        if profiler is not None:
+            tstart = time.perf_counter()
+
         self._busy = True
-        if verbose:
-            response = self._send_command_stream(cmd, True)
-        else:
-            response = self._send_command(cmd, mute=mute)
-        self._busy = False
+        try:
+            if verbose or on_output is not None:
+                response = self._send_command_stream(
+                    cmd, verbose, on_output=on_output, stream_period=stream_period
+                )
+            else:
+                response = self._send_command(cmd, mute=mute)
+        finally:
+            self._busy = False
+
+        if profiler is not None:
+            profiler._span("rpc", tstart, time.perf_counter())
 
         return response.strip()
 
@@ -926,6 +1151,18 @@ class MapdlGrpc(MapdlBase):
         """Return the MAPDL gRPC instance IP."""
         return self._ip
 
+    @property
+    def startup_timings(self) -> Dict[str, float]:
+        """Time in seconds spent in each phase of the launch of this instance.
+
+        The phases are ``"port_reservation"`` (only when launched with
+        :func:`launch_mapdl_instances() <ansys.mapdl.core.launcher.launch_mapdl_instances>`),
+        ``"launch"``, from the start of the MAPDL process until its gRPC
+        server is alive, and ``"connect"``, until this client is connected.
+        Empty if this instance connected to an already running MAPDL.
+        """
+        return self._startup_timings.copy()
+
     @protect_grpc
     def _send_command(self, cmd: str, mute: bool = False) -> Optional[str]:
         """Send a MAPDL command and return the response as a string"""
@@ -943,17 +1180,50 @@ class MapdlGrpc(MapdlBase):
         return None
 
     @protect_grpc
-    def _send_command_stream(self, cmd, verbose=False) -> str:
-        """Send a command and expect a streaming response"""
+    def _send_command_stream(
+        self,
+        cmd: str,
+        verbose: bool = False,
+        on_output: Optional[Callable[[str], None]] = None,
+        stream_period: int = STREAM_PERIOD,
+    ) -> str:
+        """Send a command and expect a streaming response.
+
+        When ``on_output`` is given, each piece of output is passed to it as
+        soon as it is received. The next pieces are not read until the
+        function returns, so a slow consumer throttles the stream instead of
+        accumulating output. Only the last ``STREAM_MAX_OUTPUT`` characters
+        are kept to be returned.
+        """
+        if stream_period <= 0:
+            raise ValueError("``stream_period`` must be greater than 0.")
+
         request = pb_types.CmdRequest(command=cmd)
-        metadata = [("time_step_stream", "100")]
+        metadata = [("time_step_stream", str(int(stream_period)))]
         stream = self._stub.SendCommandS(request, metadata=metadata)
-        response = []
-        for item in stream:
-            cmdout = "\n".join(item.cmdout)
-            if verbose:
-                print(cmdout)
-            response.append(cmdout.strip())
+
+        response = deque()
+        length = 0
+        try:
+            for item in stream:
+                cmdout = "\n".join(item.cmdout)
+                if verbose:
+                    print(cmdout)
+
+                if on_output is not None:
+                    on_output(cmdout)
+
+                cmdout = cmdout.strip()
+                response.append(cmdout)
+                length += len(cmdout)
+                if on_output is not None:
+                    # Dropping the oldest output
+                    while length > STREAM_MAX_OUTPUT and len(response) > 1:
+                        length -= len(response.popleft())
+        except BaseException:
+            # For example, an exception raised in ``on_output``.
+            stream.cancel()
+            raise
 
         return "".join(response)
 
@@ -965,7 +1235,10 @@ class MapdlGrpc(MapdlBase):
                 break
 
             try:
-                time.sleep(self._t_delay)
+                if self._heartbeat_stop.wait(self._t_delay):
+                    # Stopped on exit or because the instance is monitored
+                    # elsewhere (for example by ``MapdlPool``).
+                    break
                 if not self.is_alive:
                     break
             except ReferenceError:
@@ -973,6 +1246,77 @@ class MapdlGrpc(MapdlBase):
             except Exception:
                 continue
 
+    def _stop_heartbeat(self):
+        """Stop the heartbeat thread.
+
+        Used when the instance health is checked somewhere else, for example
+        in the ``MapdlPool`` monitor, so there is no need of one thread per
+        instance.
+        """
+        self._heartbeat_stop.set()
+
+    def _subscribe_to_channel_state(self):
+        """Track the connectivity state of the gRPC channel.
+
+        gRPC calls the subscribed function every time the channel state
+        changes, hence the health of the connection can be tracked without
+        sending any request to the server.  gRPC polls each subscribed
+        channel in its own thread, so only the instances watched by a
+        ``MapdlPool`` subscribe.
+        """
+        if self._channel_state_callback is not None:
+            return
+
+        mapdl_ref = weakref.ref(self)
+
+        def _on_channel_state_change(state):
+            mapdl = mapdl_ref()
+            if mapdl is not None:
+                mapdl._on_channel_state_change(state)
+
+        self._channel_state_callback = _on_channel_state_change
+        self._channel.subscribe(_on_channel_state_change, try_to_connect=True)
+
+    def _unsubscribe_from_channel_state(self):
+        """Stop tracking the connectivity state of the gRPC channel."""
+        if self._channel_state_callback is None:
+            return
+
+        try:
+            self._channel.unsubscribe(self._channel_state_callback)
+        except Exception:  # pragma: no cover
+            pass
+        self._channel_state_callback = None
+
+    def _on_channel_state_change(self, state: grpc.ChannelConnectivity):
+        """Store the new channel state and notify if it is unhealthy."""
+        self._channel_state = state
+        if state in UNHEALTHY_CHANNEL_STATES:
+            self._log.debug("gRPC channel state changed to %s", state)
+            self._notify_health_callbacks()
+
+    def _notify_health_callbacks(self):
+        """Call the functions registered to be notified about health changes.
+
+        Each function receives this instance as the only argument.
+        """
+        for callback in list(self._health_callbacks):
+            try:
+                callback(self)
+            except Exception:  # pragma: no cover
+                self._log.debug("Health callback failed", exc_info=True)
+
+    @property
+    def _process_has_exited(self) -> bool:
+        """Whether the MAPDL process launched with this instance has finished.
+
+        It does not require any request to the server.  ``False`` when the
+        process is not managed by this instance.
+        """
+        if self._mapdl_process is None:
+            return False
+        return self._mapdl_process.poll() is not None
+
     @protect_from(ValueError, "I/O operation on closed file.")
     def exit(self, save=False, force=False):
         """Exit MAPDL.
@@ -1041,6 +1385,9 @@ class MapdlGrpc(MapdlBase):
             self._kill_server()
 
         self._exited = True
+        self._stop_heartbeat()
+        self._unsubscribe_from_channel_state()
+        self._notify_health_callbacks()
 
         if self._remote_instance:  # pragma: no cover
             # No cover: The CI is working with a single MAPDL instance
@@ -1185,7 +1532,13 @@ class MapdlGrpc(MapdlBase):
         if not self._pids:
             # For the cases where the cleanup file is not generated,
             # we relay on the process.
-            parent_pid = self._mapdl_process.pid
+            if self._mapdl_process is not None:
+                parent_pid = self._mapdl_process.pid
+            elif self._launched_pid is not None:
+                # Process launched by someone else, for example the warm pool.
+                parent_pid = self._launched_pid
+            else:
+                return
             try:
                 parent = psutil.Process(parent_pid)
             except psutil.NoSuchProcess:
@@ -1313,6 +1666,7 @@ class MapdlGrpc(MapdlBase):
         path: Optional[Union[str, pathlib.Path]] = None,
         progress_bar: bool = False,
         preference: Optional[Literal["rst", "rth"]] = None,
+        max_workers: int = DOWNLOAD_MAX_WORKERS,
     ) -> str:
         """Download remote result files to a local directory
 
@@ -1330,6 +1684,11 @@ class MapdlGrpc(MapdlBase):
           This parameter is only required when both files are present. The default is ```None``,
           in which case ``"rst"`` is used.
 
+        max_workers : int, optional
+          Maximum number of distributed result files downloaded at the
+          same time. The default is ``4``.
+
+
         Examples
         --------
         Download remote result files into the current working directory
@@ -1338,13 +1697,17 @@ class MapdlGrpc(MapdlBase):
         >>> mapdl.download_result(os.getcwd())
 
         """
+        self._flush_batch()
         if path is None:  # if not path seems to not work in same cases.
             path = os.getcwd()
 
         def _download(targets: List[str]) -> None:
-            for target in targets:
-                save_name = os.path.join(path, target)
-                self._download(target, save_name, progress_bar=progress_bar)
+            self._download_files(
+                targets,
+                path,
+                progress_bar=progress_bar,
+                max_workers=max_workers,
+            )
 
         if preference:
             if preference not in ["rst", "rth"]:
@@ -1560,6 +1923,7 @@ class MapdlGrpc(MapdlBase):
         chunk_size=512,
         orig_cmd="/INP",
         write_to_log=True,
+        use_cache=False,
         **kwargs,
     ):
         """Stream a local input file to a remote mapdl instance.
@@ -1623,6 +1987,12 @@ class MapdlGrpc(MapdlBase):
             to run something different than ``/INPUT``, for example
             ``CDREAD``.
 
+        use_cache : bool, optional
+            Skip the upload when the same file is already in the MAPDL
+            working directory, and keep it there once it has been read.
+            See :func:`Mapdl.upload() <ansys.mapdl.core.Mapdl.upload>`.
+            The default is ``False``.
+
         Returns
         -------
         str
@@ -1666,6 +2036,7 @@ class MapdlGrpc(MapdlBase):
                 mapdl.run("/input,inputtrigger,inp") # This inputs 'myinput.inp'
 
         """
+        self._flush_batch()
         # Checking compatibility
         # Checking the user is not reusing old api:
         #
@@ -1732,7 +2103,7 @@ class MapdlGrpc(MapdlBase):
         # Running method
         # always check if file is present as the grpc and MAPDL errors
         # are unclear
-        filename = self._get_file_path(fname, progress_bar)
+        filename = self._get_file_path(fname, progress_bar, use_cache=use_cache)
 
         if time_step_stream is not None:
             if time_step_stream <= 0:
@@ -1760,6 +2131,48 @@ class MapdlGrpc(MapdlBase):
         # otherwise, not verbose
         if time_step_stream is None:
             time_step_stream = 50
+
+        return self._input_uploaded_file(
+            filename,
+            orig_cmd=orig_cmd,
+            time_step_stream=time_step_stream,
+            chunk_size=chunk_size,
+            write_to_log=write_to_log,
+            keep_file=use_cache,
+            **kwargs,
+        )
+
+    def _input_uploaded_file(
+        self,
+        filename: str,
+        orig_cmd: str = "/INP",
+        time_step_stream: int = 50,
+        chunk_size: int = DEFAULT_CHUNKSIZE,
+        write_to_log: bool = True,
+        remove_file: bool = False,
+        keep_file: bool = False,
+        **kwargs,
+    ) -> Optional[str]:
+        """Run a file available to the MAPDL server and return its output.
+
+        Parameters
+        ----------
+        filename : str
+            Path of the file in the MAPDL host, or its name if it is in the
+            MAPDL working directory.
+
+        orig_cmd : str, optional
+            Command used to read the file. Defaults to ``"/INP"``.
+
+        remove_file : bool, optional
+            Remove the file from the MAPDL working directory once it has
+            run. Otherwise, on remote instances, it is removed only if it
+            is an input file found in the MAPDL working directory.
+
+        keep_file : bool, optional
+            Never remove an input file from the MAPDL working directory,
+            unless ``remove_file=True``.
+        """
         metadata = [
             ("time_step_stream", str(time_step_stream)),
             ("chunk_size", str(chunk_size)),
@@ -1781,7 +2194,7 @@ class MapdlGrpc(MapdlBase):
         else:
             # Using default INPUT
             tmp_dat = f"/OUT,{tmp_out}\n{orig_cmd},'{filename}'\n"
-            delete_uploaded_files = True
+            delete_uploaded_files = not keep_file
 
         if write_to_log and self._apdl_log is not None:
             if not self._apdl_log.closed:
@@ -1815,15 +2228,15 @@ class MapdlGrpc(MapdlBase):
                 output = f.read()
 
             # delete the files to avoid overwriting:
-            try:
-                os.remove(tmp_name_path)
-            except OSError:
-                pass
+            removed_files = [tmp_name_path, tmp_out_path]
+            if remove_file:
+                removed_files.append(os.path.join(local_path, filename))
 
-            try:
-                os.remove(tmp_out_path)
-            except OSError:
-                pass
+            for each_file in removed_files:
+                try:
+                    os.remove(each_file)
+                except OSError:
+                    pass
 
         # otherwise, read remote file
         else:
@@ -1832,12 +2245,14 @@ class MapdlGrpc(MapdlBase):
             # Deleting the previous files
             self.slashdelete(tmp_name)
             self.slashdelete(tmp_out)
-            if filename in self.list_files() and delete_uploaded_files:
+            if remove_file or (delete_uploaded_files and filename in self.list_files()):
                 self.slashdelete(filename)
 
         return output
 
-    def _get_file_path(self, fname: str, progress_bar: bool = False) -> str:
+    def _get_file_path(
+        self, fname: str, progress_bar: bool = False, use_cache: bool = False
+    ) -> str:
         """Find files in the Python and MAPDL working directories.
 
         **The priority is for the Python directory.**
@@ -1886,7 +2301,7 @@ class MapdlGrpc(MapdlBase):
         else:  # Non-local
             # upload the file if it exists locally
             if os.path.isfile(ffullpath):
-                self.upload(ffullpath, progress_bar=progress_bar)
+                self.upload(ffullpath, progress_bar=progress_bar, use_cache=use_cache)
                 filename = fname
 
             elif not self._store_commands and fname in self.list_files():
@@ -1945,8 +2360,10 @@ class MapdlGrpc(MapdlBase):
         return fname
 
     def _flush_stored(self):
-        """Writes stored commands to an input file and runs the input
-        file.  Used with non_interactive.
+        """Stream the stored commands to MAPDL and run them.
+
+        Used with non_interactive. The commands are uploaded from memory,
+        hence no temporary input file is written to the local disk.
         """
         self._log.debug("Flushing stored commands")
 
@@ -1954,33 +2371,21 @@ class MapdlGrpc(MapdlBase):
         if self._apdl_log:
             self._apdl_log.write(commands + "\n")
 
-        self._log.debug(
-            "Writing the following commands to a temporary " "apdl input file:\n%s",
-            commands,
-        )
-
-        # write to a temporary input file
-        def build_rand_tmp():
-            return os.path.join(tempfile.gettempdir(), f"tmp_{random_string()}.inp")
-
-        # rare case of duplicated tmpfile (birthday problem)
-        tmp_filename = build_rand_tmp()
-        while os.path.isfile(tmp_filename):
-            tmp_filename = build_rand_tmp()
-
-        with open(tmp_filename, "w") as fid:
-            fid.writelines(commands)
+        self._log.debug("Streaming the following commands to MAPDL:\n%s", commands)
 
         self._store_commands = False
         self._stored_commands = []
 
+        # upload the stored commands straight from memory
+        tmp_filename = f"tmp_{random_string()}.inp"
+        self._upload_raw(commands.encode(), tmp_filename)
+
         # run the stored commands
-        out = self.input(
+        out = self._input_uploaded_file(
             tmp_filename,
             write_to_log=False,
-            verbose=False,
             chunk_size=DEFAULT_CHUNKSIZE,
-            progress_bar=False,
+            remove_file=True,
         )
         # skip the first line as it simply states that it's reading an input file
         self._response = out[out.find("LINE=       0") + 13 :]
@@ -1989,11 +2394,298 @@ class MapdlGrpc(MapdlBase):
         if not self._ignore_errors:
             self._raise_errors(self._response)
 
-        # try/except here because MAPDL might have not closed the temp file
+    @property
+    def batching(self):
+        """Automatic command batching context manager.
+
+        Inside this context manager, the commands which do not return data
+        are not sent to MAPDL one by one. They are queued and sent all
+        together as one input file when a result is requested, for example
+        with :func:`Mapdl.get_value() <ansys.mapdl.core.Mapdl.get_value>`,
+        :attr:`Mapdl.parameters <ansys.mapdl.core.Mapdl.parameters>` or
+        :attr:`Mapdl.mesh <ansys.mapdl.core.Mapdl.mesh>`, or when the context
+        manager exits.  This saves one round trip to the server per command.
+
+        Notes
+        -----
+        The queued commands have no output, hence
+        :func:`Mapdl.run() <ansys.mapdl.core.Mapdl.run>` and the command
+        methods return ``None``, like inside
+        :attr:`Mapdl.non_interactive <ansys.mapdl.core.Mapdl.non_interactive>`.
+        Listing, printing and plotting commands, ``*GET``, ``/INQUIRE``,
+        ``*STATUS``, ``/OUTPUT``, ``/CLEAR`` and ``/EXIT`` are sent right
+        away, once the queued commands have run, so their output is returned
+        as usual.
+
+        The errors raised by the queued commands are raised when the
+        commands are flushed. The error message includes the offending
+        command.
+
+        Examples
+        --------
+        Build a model with a single request to the server.
+
+        >>> with mapdl.batching:
+        ...     mapdl.prep7()
+        ...     for i in range(1, 1001):
+        ...         mapdl.n(i, i, 0, 0)
+        ...     n_nodes = mapdl.get_value("NODE", 0, "COUNT")  # flushed here
+        >>> n_nodes
+        1000.0
+
+        """
+        return self._batching_context(self)
+
+    class _batching_context:
+        """Queue the commands which do not return data."""
+
+        def __init__(self, parent):
+            self._parent = weakref.ref(parent)
+
+        def __enter__(self):
+            self._parent()._log.debug("Entering batching mode")
+            self._previous_batching = self._parent()._batching
+            self._parent()._batching = True
+
+        def __exit__(self, *args):
+            mapdl = self._parent()
+            mapdl._batching = self._previous_batching
+            if mapdl._batching:
+                # Nested context manager. The outer one flushes.
+                return
+
+            if args[0] is not None:
+                mapdl._log.debug(
+                    "An exception was found in the `batching` environment. "
+                    "Hence the %d queued commands are not flushed.",
+                    len(mapdl._batch),
+                )
+                mapdl._batch = []
+            else:
+                mapdl._log.debug("Exiting batching mode")
+                mapdl._flush_batch()
+
+    def solve_async(
+        self,
+        action: str = "",
+        on_progress: Optional[Callable[[Dict[str, Any]], None]] = None,
+        stream_period: int = STREAM_PERIOD,
+    ) -> SolveHandle:
+        """Start a solution and return without waiting for it to finish.
+
+        The solution output is streamed while it runs and parsed to report
+        the load step, substep, equilibrium iteration, time and convergence
+        norms, so a diverging solution can be detected and stopped early.
+
+        Parameters
+        ----------
+        action : str, optional
+            Argument of the :func:`Mapdl.solve() <ansys.mapdl.core.Mapdl.solve>`
+            command.
+
+        on_progress : callable, optional
+            Function called with each progress event. See
+            :func:`parse_solve_line() <ansys.mapdl.core.solution.parse_solve_line>`.
+
+        stream_period : int, optional
+            Period, in milliseconds, at which the output is streamed. The
+            default is ``100``.
+
+        Returns
+        -------
+        ansys.mapdl.core.solution.SolveHandle
+            Handle to follow, wait for or cancel the solution.
+
+        Notes
+        -----
+        Other commands sent to this MAPDL instance raise a
+        ``MapdlRuntimeError`` until the solution finishes, for example after
+        calling :func:`SolveHandle.result()
+        <ansys.mapdl.core.solution.SolveHandle.result>`.
+
+        Examples
+        --------
+        >>> handle = mapdl.solve_async()
+        >>> while not handle.wait(timeout=1):
+        ...     force = handle.progress["convergence"].get("FORCE")
+        ...     if force and force["value"] > 1e6 * force["criterion"]:
+        ...         handle.cancel()
+        >>> output = handle.result()
+
+        """
+        # The abort file location is resolved now because MAPDL is busy
+        # once the solution starts.
+        abort_name = f"{self.jobname}.abt"
+        abort_file = None
+        if self._local:
+            abort_file = os.path.join(self.directory, abort_name)
+
+        command = f"SOLVE,{action}" if action else "SOLVE"
+        self._solve_handle = SolveHandle(
+            self,
+            command,
+            abort_file=abort_file,
+            remote_abort_file=abort_name,
+            on_progress=on_progress,
+            stream_period=stream_period,
+        )
+        return self._solve_handle
+
+    def _check_no_solve_running(self):
+        """Raise an error if a solution started by ``solve_async`` is running.
+
+        The commands sent by the thread running the solution are allowed.
+        """
+        handle = self._solve_handle
+        if handle is None or handle.done:
+            return
+        if threading.current_thread() is not handle._thread:
+            raise MapdlRuntimeError(
+                "A solution started with 'solve_async()' is still running. "
+                "Wait for it to finish with 'SolveHandle.result()' or "
+                "'SolveHandle.wait()' before sending other commands."
+            )
+
+    def profile(self, latency: Optional[float] = None):
+        """Profile the commands run inside this context manager.
+
+        The duration of each command run through :func:`Mapdl.run()
+        <ansys.mapdl.core.Mapdl.run>`, which includes the command methods
+        such as ``mapdl.prep7()``, is split in the time spent in PyMAPDL,
+        in the network, in MAPDL and parsing the response. See
+        :class:`CommandProfiler <ansys.mapdl.core.profiler.CommandProfiler>`.
+
+        Parameters
+        ----------
+        latency : float, optional
+            Round trip time in seconds of an empty gRPC request, used to
+            split the request time between the network and MAPDL. By
+            default, it is measured when entering the context manager.
+
+        Returns
+        -------
+        ansys.mapdl.core.profiler.CommandProfiler
+            Profiler returned when entering the context manager.
+
+        Examples
+        --------
+        >>> with mapdl.profile() as profiler:
+        ...     mapdl.prep7()
+        ...     mapdl.block(0, 1, 0, 1, 0, 1)
+        ...     mapdl.vmesh("ALL")
+        >>> profiler.summary()["VMESH"]["server"]
+        0.0457
+
+        Export the timeline.
+
+        >>> profiler.to_chrome_trace("trace.json")
+
+        """
+        return self._profile_context(self, latency)
+
+    class _profile_context:
+        """Record the timings of the commands."""
+
+        def __init__(self, parent, latency):
+            self._parent = weakref.ref(parent)
+            self._latency = latency
+
+        def __enter__(self) -> CommandProfiler:
+            mapdl = self._parent()
+            if mapdl._profiler is not None:
+                raise MapdlRuntimeError("The commands are already being profiled.")
+
+            latency = self._latency
+            if latency is None:
+                latency = mapdl._measure_latency()
+
+            mapdl._log.debug("Profiling commands (latency: %f s)", latency)
+            mapdl._profiler = CommandProfiler(latency=latency)
+            return mapdl._profiler
+
+        def __exit__(self, *args):
+            self._parent()._profiler = None
+
+    def _measure_latency(self, n_requests: int = 5) -> float:
+        """Minimum round trip time in seconds of a request doing nothing."""
+        latency = float("inf")
+        for _ in range(n_requests):
+            tstart = time.perf_counter()
+            self._send_command("/COM", mute=True)
+            latency = min(latency, time.perf_counter() - tstart)
+        return latency
+
+    @staticmethod
+    def _is_batchable(cmd: str) -> bool:
+        """Whether the command can be queued in batching mode."""
+        name = cmd.split(",")[0].strip().upper()
+        if name[:4] in NOT_BATCHED_COMMANDS or name[:4] in PLOT_COMMANDS:
+            return False
+        # Listing and printing commands, for example NLIST or PRNSOL
+        return not (name.endswith(("LIST", "LIS")) or name.startswith("PR"))
+
+    def _flush_batch(self):
+        """Run the commands queued in batching mode as a single input file.
+
+        A comment with the command index is written before each command, so
+        the errors can be mapped back to the command which raised them.
+
+        Call it in the calling thread before any request which needs the
+        effects of the queued commands. It does nothing if there are no
+        queued commands.
+        """
+        if self._flushing_batch or not self._batch:
+            return
+
+        commands, self._batch = self._batch, []
+
+        self._log.debug("Flushing %d batched commands", len(commands))
+
+        lines = []
+        for i, command in enumerate(commands):
+            lines.append(f"/COM,{BATCH_MARKER.format(i)}")
+            lines.append(command)
+
+        tmp_filename = f"tmp_batch_{random_string()}.inp"
+        self._flushing_batch = True
         try:
-            os.remove(tmp_filename)
-        except:
-            self._log.warning("Unable to remove temporary file %s", tmp_filename)
+            self._upload_raw("\n".join(lines).encode(), tmp_filename)
+            out = self._input_uploaded_file(
+                tmp_filename,
+                write_to_log=False,
+                chunk_size=DEFAULT_CHUNKSIZE,
+                remove_file=True,
+            )
+        finally:
+            self._flushing_batch = False
+
+        self._response = out[out.find("LINE=       0") + 13 :]
+        self._log.info(self._response)
+
+        if not self._ignore_errors:
+            self._raise_batch_errors(self._response, commands)
+
+    def _raise_batch_errors(self, text: str, commands: List[str]):
+        """Raise the errors found in the output of the batched commands.
+
+        The error message includes the command which raised the error.
+        """
+        pieces = BATCH_MARKER_PATTERN.split(text)
+        if len(pieces) == 1:
+            # The comments were not written, for example because of /NOPR.
+            self._raise_errors(text)
+            return
+
+        # pieces = [header, index_0, output_0, index_1, output_1, ...]
+        for index, output in zip(pieces[1::2], pieces[2::2]):
+            try:
+                self._raise_errors(output)
+            except MapdlException as error:
+                command = commands[int(index)]
+                raise error.__class__(
+                    f"The batched command number {int(index) + 1} ('{command}') "
+                    f"raised the following error:\n{error}"
+                ) from None
 
     @protect_grpc
     def _get(
@@ -2016,6 +2708,7 @@ class MapdlGrpc(MapdlBase):
            Not thread safe.  Uses ``_get_lock`` to ensure multiple
            request are not evaluated simultaneously.
         """
+        self._flush_batch()
         if self._session_id is not None:
             self._check_session_id()
 
@@ -2069,6 +2762,7 @@ class MapdlGrpc(MapdlBase):
         extensions: Optional[Union[str, List[str], Tuple[str]]] = None,
         target_dir: Optional[str] = None,
         progress_bar: bool = False,
+        max_workers: int = DOWNLOAD_MAX_WORKERS,
     ) -> List[str]:
         """Download all the project files located in the MAPDL working directory.
 
@@ -2086,6 +2780,10 @@ class MapdlGrpc(MapdlBase):
             ``tqdm`` when ``True``.  Helpful for showing download
             progress. The default is ``False``.
 
+        max_workers : int, optional
+            Maximum number of files downloaded at the same time from a
+            remote instance. The default is ``4``.
+
         Returns
         -------
         List[Str]
@@ -2093,7 +2791,10 @@ class MapdlGrpc(MapdlBase):
         """
         if not extensions:
             list_of_files = self.download(
-                files="*", target_dir=target_dir, progress_bar=progress_bar
+                files="*",
+                target_dir=target_dir,
+                progress_bar=progress_bar,
+                max_workers=max_workers,
             )
 
         else:
@@ -2105,6 +2806,7 @@ class MapdlGrpc(MapdlBase):
                         target_dir=target_dir,
                         extension=each_extension,
                         progress_bar=progress_bar,
+                        max_workers=max_workers,
                     )
                 )
 
@@ -2118,6 +2820,7 @@ class MapdlGrpc(MapdlBase):
         chunk_size: Optional[int] = None,
         progress_bar: Optional[bool] = None,
         recursive: bool = False,
+        max_workers: int = DOWNLOAD_MAX_WORKERS,
     ) -> List[str]:
         """Download files from the gRPC instance working directory
 
@@ -2143,7 +2846,8 @@ class MapdlGrpc(MapdlBase):
             Filename with this extension will be considered. The default is None.
 
         chunk_size : int, optional
-            Chunk size in bytes.  Must be less than 4MB. The default is 256 kB.
+            Chunk size in bytes.  Must be less than 4MB. The default is the
+            ``chunk_size`` given when connecting, or 256 kB.
 
         progress_bar : bool, optional
             Display a progress bar using ``tqdm`` when ``True``.
@@ -2152,6 +2856,10 @@ class MapdlGrpc(MapdlBase):
         recursive : bool, optional
             Whether to use recursion when using glob pattern. The default is ``False``.
 
+        max_workers : int, optional
+            Maximum number of files downloaded at the same time from a
+            remote instance. The default is ``4``.
+
         Notes
         -----
         There are some considerations to keep in mind when using this command:
@@ -2162,6 +2870,9 @@ class MapdlGrpc(MapdlBase):
         * If you are in local and provide a file path, downloading files
           from a different folder is allowed.
           However it is not a recommended approach.
+        * Files downloaded from a remote instance are written to a ``.part``
+          file first and renamed once complete. An interrupted download is
+          restarted from the beginning.
 
         Examples
         --------
@@ -2184,7 +2895,7 @@ class MapdlGrpc(MapdlBase):
 
         """
         if chunk_size is None:
-            chunk_size = DEFAULT_CHUNKSIZE
+            chunk_size = self._get_chunk_size(DEFAULT_CHUNKSIZE)
 
         if chunk_size > 4 * 1024 * 1024:  # 4MB
             raise ValueError(
@@ -2216,6 +2927,7 @@ class MapdlGrpc(MapdlBase):
                 extension=extension,
                 chunk_size=chunk_size,
                 progress_bar=progress_bar,
+                max_workers=max_workers,
             )
 
     def _download_on_local(
@@ -2291,6 +3003,7 @@ class MapdlGrpc(MapdlBase):
         extension: Optional[str] = None,
         chunk_size: Optional[str] = None,
         progress_bar: Optional[str] = None,
+        max_workers: int = DOWNLOAD_MAX_WORKERS,
     ) -> List[str]:
         """Download files when we are connected to a remote session."""
 
@@ -2312,13 +3025,13 @@ class MapdlGrpc(MapdlBase):
                 "Only strings, tuple of strings or list of strings are allowed."
             )
 
-        for each_file in list_files:
-            self._download(
-                each_file,
-                out_file_name=os.path.join(target_dir, each_file),
-                chunk_size=chunk_size,
-                progress_bar=progress_bar,
-            )
+        self._download_files(
+            list_files,
+            target_dir,
+            chunk_size=chunk_size,
+            progress_bar=progress_bar,
+            max_workers=max_workers,
+        )
 
         return list_files
 
@@ -2357,16 +3070,117 @@ class MapdlGrpc(MapdlBase):
 
         return list_files
 
+    def _remote_file_fingerprint(self, filename: str) -> Optional[Tuple[str, str]]:
+        """Size and modification date of a file in the MAPDL working directory.
+
+        ``/INQUIRE`` reports the size in MB and the date to the second, so
+        this is not an exact fingerprint of the content.
+
+        Returns ``None`` if they cannot be retrieved.
+        """
+        if self._store_commands:
+            # The ``/INQUIRE`` commands would be recorded, not run
+            return None
+
+        fname, ext = os.path.splitext(filename)
+        # Files are downloaded from several threads, but commands must not
+        # be sent concurrently.
+        with self._sync_lock:
+            try:
+                return (
+                    self.inquire("", "SIZE", fname, ext[1:]),
+                    self.inquire("", "DATE", fname, ext[1:]),
+                )
+            except Exception:
+                return None
+
+    def _download_files(
+        self,
+        targets: List[str],
+        target_dir: str,
+        chunk_size: Optional[int] = None,
+        progress_bar: bool = False,
+        max_workers: int = DOWNLOAD_MAX_WORKERS,
+    ) -> List[str]:
+        """Download several files from the gRPC instance concurrently.
+
+        When ``progress_bar=True`` and there are several files, a single
+        progress bar reports the total downloaded bytes and the throughput.
+
+        Returns
+        -------
+        List[str]
+            Local paths of the downloaded files.
+        """
+        # Flush here, since ``_download`` runs in the worker threads
+        self._flush_batch()
+        out_files = [os.path.join(target_dir, target) for target in targets]
+
+        if len(targets) < 2 or max_workers < 2:
+            for target, out_file in zip(targets, out_files):
+                self._download(
+                    target,
+                    out_file_name=out_file,
+                    chunk_size=chunk_size,
+                    progress_bar=progress_bar,
+                )
+            return out_files
+
+        pbar = None
+        if progress_bar:
+            pbar = _download_progress_bar(f"Downloading {len(targets)} files")
+
+        try:
+            with ThreadPoolExecutor(
+                max_workers=min(max_workers, len(targets)),
+                thread_name_prefix="download",
+            ) as executor:
+                futures = [
+                    executor.submit(
+                        self._download,
+                        target,
+                        out_file_name=out_file,
+                        chunk_size=chunk_size,
+                        pbar=pbar,
+                        check_alive=False,
+                    )
+                    for target, out_file in zip(targets, out_files)
+                ]
+                for n_done, future in enumerate(as_completed(futures), start=1):
+                    try:
+                        future.result()
+                    except grpc.RpcError:
+                        # Commands must not be sent from the worker threads,
+                        # so the server is checked once here.
+                        if not self.is_alive:
+                            for each in futures:
+                                each.cancel()
+                        raise
+                    if pbar is not None:
+                        pbar.set_postfix_str(f"{n_done}/{len(targets)} files")
+        finally:
+            if pbar is not None:
+                pbar.close()
+
+        return out_files
+
     @protect_grpc
     def _download(
         self,
         target_name: str,
         out_file_name: Optional[str] = None,
-        chunk_size: int = DEFAULT_CHUNKSIZE,
+        chunk_size: Optional[int] = None,
         progress_bar: bool = False,
+        retries: int = DOWNLOAD_RETRIES,
+        pbar: Optional["tqdm"] = None,
+        check_alive: bool = True,
     ) -> None:
         """Download a file from the gRPC instance.
 
+        The file is first written to ``<out_file_name>.part`` and renamed
+        once it is complete, so an interrupted download never leaves a
+        truncated ``out_file_name``.
+
         Parameters
         ----------
         target_name : str
@@ -2379,38 +3193,77 @@ class MapdlGrpc(MapdlBase):
             ``target_name``.
 
         chunk_size : int, optional
-            Chunk size in bytes.  Must be less than 4MB.  The default is 256 kB.
+            Chunk size in bytes.  Must be less than 4MB.  The default is the
+            ``chunk_size`` given when connecting, or 256 kB.
 
         progress_bar : bool, optional
             Display a progress bar using ``tqdm`` when ``True``.
             Helpful for showing download progress. The default is
             ``False`` to avoid excessive command printout.
 
+        retries : int, optional
+            Number of times an interrupted download is restarted before
+            raising the error. The ``DownloadFile`` request has no offset,
+            so the whole file is downloaded again.
+
+
+        pbar : tqdm.tqdm, optional
+            Progress bar shared between several downloads.
+
+        check_alive : bool, optional
+            Stop retrying when the server is not alive. This sends a
+            request, hence it must be ``False`` in worker threads.
+
         Examples
         --------
         Download the remote result file "file.rst" as "my_result.rst"
 
         >>> mapdl.download('file.rst', 'my_result.rst')
         """
-
         if progress_bar and _HAS_TQDM:
             progress_bar = True
 
         if out_file_name is None:
             out_file_name = target_name
+        out_file_name = os.fspath(out_file_name)
+
+        part_file = out_file_name + ".part"
+
+        if chunk_size is None:
+            chunk_size = self._get_chunk_size(DEFAULT_CHUNKSIZE)
 
         request = pb_types.DownloadFileRequest(name=target_name)
         metadata = [
             ("time_step_stream", "200"),
             ("chunk_size", str(chunk_size)),
         ]
-        chunks = self._stub.DownloadFile(request, metadata=metadata)
-        file_size = save_chunks_to_file(
-            chunks,
-            out_file_name,
-            progress_bar=progress_bar,
-            target_name=target_name,
-        )
+
+        n_retries = 0
+        tstart = time.time()
+        while True:
+            chunks = self._stub.DownloadFile(request, metadata=metadata)
+            try:
+                file_size = save_chunks_to_file(
+                    chunks,
+                    part_file,
+                    progress_bar=progress_bar,
+                    target_name=target_name,
+                    pbar=pbar,
+                )
+                break
+            except grpc.RpcError:
+                if n_retries >= retries or (check_alive and not self.is_alive):
+                    raise
+
+                n_retries += 1
+                self._log.warning(
+                    f"Download of '{target_name}' interrupted. "
+                    f"Restarting it ({n_retries}/{retries})."
+                )
+
+        self._record_transfer(file_size, time.time() - tstart)
+
+        os.replace(part_file, out_file_name)
 
         if not file_size:
             warn(
@@ -2418,7 +3271,9 @@ class MapdlGrpc(MapdlBase):
             )
 
     @protect_grpc
-    def upload(self, file_name: str, progress_bar: bool = _HAS_TQDM) -> str:
+    def upload(
+        self, file_name: str, progress_bar: bool = _HAS_TQDM, use_cache: bool = False
+    ) -> str:
         """Upload a file to the grpc instance
 
         file_name : str
@@ -2428,28 +3283,98 @@ class MapdlGrpc(MapdlBase):
             Whether to display a progress bar using ``tqdm``. The default is ``True``.
             This parameter is helpful for showing download progress.
 
+        use_cache : bool, optional
+            Skip the upload when a file with the same name and content has
+            already been uploaded with ``use_cache=True``, by this or by a
+            previous Python session, and the remote copy seems unchanged
+            since. The default is ``False``.
+
         Returns
         -------
         str
             Base name of the file uploaded.  File can be accessed
             relative to the mapdl instance with this file name.
 
+        Notes
+        -----
+        With ``use_cache=True``, a ``<file_name>.pymapdl_upload`` file is
+        written next to the uploaded file in the MAPDL working directory.
+        It records the SHA-256 digest of the uploaded content, and the
+        size in MB and the modification date to the second of the remote
+        copy, as reported by ``/INQUIRE`` right after the upload.  The
+        upload is skipped when the digest of the local file and the
+        current remote size and date match this record.  Consider the
+        following:
+
+        * A remote copy rewritten within the same second with a similar
+          size, without ``use_cache=True``, is not detected.
+        * Each call reads the whole local file, downloads the record and
+          sends two ``/INQUIRE`` requests, which is only worth it for large
+          files.
+        * The cache is not used inside
+          :attr:`Mapdl.non_interactive <ansys.mapdl.core.Mapdl.non_interactive>`.
+
         Examples
         --------
         Upload "local_file.inp" while disabling the progress bar
 
         >>> mapdl.upload('local_file.inp', progress_bar=False)
         """
+        self._flush_batch()
         if not os.path.isfile(file_name):
             raise FileNotFoundError(f"Unable to locate filename {file_name}")
+
+        basename = os.path.basename(file_name)
+        # Commands are only recorded inside ``non_interactive``
+        use_cache = use_cache and not self._store_commands
+        if use_cache:
+            checksum = file_checksum(file_name)
+            record = self._read_upload_record(basename)
+            if record is not None and record[0] == checksum:
+                fingerprint = self._remote_file_fingerprint(basename)
+                if fingerprint is not None and fingerprint == record[1]:
+                    self._log.debug(
+                        f"File '{file_name}' is already in the MAPDL instance."
+                    )
+                    return basename
+
         self._log.debug(f"Uploading file '{file_name}' to the MAPDL instance.")
 
-        chunks_generator = get_file_chunks(file_name, progress_bar=progress_bar)
+        chunks_generator = get_file_chunks(
+            file_name,
+            progress_bar=progress_bar,
+            chunk_size=self._get_chunk_size(DEFAULT_FILE_CHUNK_SIZE),
+        )
+        tstart = time.time()
         response = self._stub.UploadFile(chunks_generator)
 
         if not response.length:
             raise IOError("File failed to upload")
-        return os.path.basename(file_name)
+        self._record_transfer(response.length, time.time() - tstart)
+
+        if use_cache:
+            fingerprint = self._remote_file_fingerprint(basename)
+            if fingerprint is not None:
+                record = "\n".join((checksum,) + fingerprint)
+                self._upload_raw(record.encode(), basename + UPLOAD_RECORD_SUFFIX)
+
+        return basename
+
+    def _read_upload_record(self, basename: str) -> Optional[Tuple[str, Tuple]]:
+        """Digest and remote fingerprint recorded when uploading a file.
+
+        Returns ``None`` when the file was not uploaded with
+        ``use_cache=True``.
+        """
+        try:
+            record = self._download_as_raw(basename + UPLOAD_RECORD_SUFFIX)
+        except grpc.RpcError:
+            return None
+
+        fields = record.decode(errors="replace").split("\n")
+        if len(fields) != 3:
+            return None
+        return fields[0], tuple(fields[1:])
 
     @protect_grpc
     def _get_array(
@@ -2477,6 +3402,7 @@ class MapdlGrpc(MapdlBase):
         values : np.ndarray
             Numpy 1D array containing the requested *VGET item and entity.
         """
+        self._flush_batch()
         if "parm" in kwargs:
             raise ValueError("Parameter name `parm` not supported with gRPC")
 
@@ -2492,6 +3418,103 @@ class MapdlGrpc(MapdlBase):
             self._vget_lock = False
         return values
 
+    def _binary_listing(self, func, *args, **kwargs):
+        """Fetch the table of a listing command as binary ``*VGET`` arrays.
+
+        Only the default forms of ``NLIST`` and ``PRNSOL`` are supported.
+        For any other command or argument, ``None`` is returned so the
+        command is run and its text output parsed instead.
+        """
+        if self._store_commands:
+            return None
+
+        try:
+            arguments = inspect.signature(func).bind(*args, **kwargs).arguments
+        except TypeError:
+            return None
+        arguments.pop("kwargs", None)
+        arguments = {key: str(value).strip() for key, value in arguments.items()}
+
+        name = func.__name__.upper()
+        if name == "NLIST":
+            return self._binary_nlist(**arguments)
+        elif name == "PRNSOL":
+            return self._binary_prnsol(**arguments)
+        return None
+
+    def _binary_nlist(self, node1="", node2="", ninc="", **kwargs):
+        """``NLIST`` table from ``*VGET`` arrays."""
+        if any(kwargs.values()):
+            # Coordinates listing, sorting or internal nodes
+            return None
+
+        if node1.upper() in ["", "ALL"]:
+            node_range = None
+        else:
+            try:
+                node1 = int(float(node1))
+                node2 = int(float(node2)) if node2 else node1
+                ninc = int(float(ninc)) if ninc else 1
+            except ValueError:  # Component names
+                return None
+            node_range = (node1, node2, max(ninc, 1))
+
+        mask = self.get_array("NODE", item1="NSEL") == 1
+        nnum = np.arange(1, mask.size + 1)
+        if node_range is not None:
+            node1, node2, ninc = node_range
+            mask &= (nnum >= node1) & (nnum <= node2) & ((nnum - node1) % ninc == 0)
+
+        table = [nnum[mask]]
+        for _, item, comp in NLIST_BINARY_COLUMNS:
+            table.append(self.get_array("NODE", item1=item, it1num=comp)[mask])
+
+        columns = ["NODE"] + [each[0] for each in NLIST_BINARY_COLUMNS]
+        return BinaryListingOutput(
+            np.column_stack(table).astype(np.float64), "NLIST", columns
+        )
+
+    def _binary_prnsol(self, item="", comp=""):
+        """``PRNSOL`` table from ``*VGET`` arrays."""
+        item, comp = item.upper(), comp.upper()
+        if item not in PRNSOL_BINARY_ITEMS:
+            return None
+
+        components = PRNSOL_BINARY_ITEMS[item]
+        if comp in components:
+            components = components[comp]
+        elif comp in components[""]:
+            components = [comp]
+        else:
+            return None
+
+        post = self.post_processing
+        if item in PRNSOL_ELEMENT_ITEMS:
+            # Same nodes as the text listing
+            with self.save_selection:
+                self.nsle("R")
+                mask = post.selected_nodes
+        else:
+            mask = post.selected_nodes
+        values = {}
+
+        def nodal_values(comp):
+            if comp not in values:
+                if comp == "SUM":
+                    xyz = [nodal_values(each) for each in ["X", "Y", "Z"]]
+                    values[comp] = np.linalg.norm(xyz, axis=0)
+                else:
+                    values[comp] = post._ndof_rst(item, comp)[mask]
+            return values[comp]
+
+        table = [np.arange(1, mask.size + 1)[mask]]
+        table.extend(nodal_values(each) for each in components)
+
+        columns = ["NODE"] + [f"{item}{each}" for each in components]
+        return BinaryListingOutput(
+            np.column_stack(table).astype(np.float64), f"PRNSOL,{item},{comp}", columns
+        )
+
     def _screenshot_path(self):
         """Returns the local path of the MAPDL generated screenshot.
 
@@ -2518,6 +3541,7 @@ class MapdlGrpc(MapdlBase):
         """Download a file from the gRPC instance as a binary
         string without saving it to disk.
         """
+        self._flush_batch()
         request = pb_types.DownloadFileRequest(name=target_name)
         chunks = self._stub.DownloadFile(request)
         return b"".join([chunk.payload for chunk in chunks])
@@ -2529,10 +3553,16 @@ class MapdlGrpc(MapdlBase):
             return False
         if self.busy:
             return True
+
+        # Do not flush the queued commands here, since their errors would be
+        # swallowed.  ``/INQUIRE`` does not depend on them.
+        bypass_batch, self._flushing_batch = self._flushing_batch, True
         try:
             return bool(self.inquire("", "JOBNAME"))
         except:
             return False
+        finally:
+            self._flushing_batch = bypass_batch
 
     @property
     def xpl(self) -> "ansXpl":
@@ -2566,6 +3596,7 @@ class MapdlGrpc(MapdlBase):
         If parameter does not exist, returns ``None``.
 
         """
+        self._flush_batch()
         request = pb_types.ParameterRequest(name=pname, array=False)
         presponse = self._stub.GetParameter(request)
         if presponse.val:
@@ -2574,20 +3605,44 @@ class MapdlGrpc(MapdlBase):
     @protect_grpc
     def _upload_raw(self, raw, save_as):  # consider private
         """Upload a binary string as a file"""
-        chunks = chunk_raw(raw, save_as)
+        chunks = chunk_raw(
+            raw, save_as, chunk_size=self._get_chunk_size(DEFAULT_FILE_CHUNK_SIZE)
+        )
+        tstart = time.time()
         response = self._stub.UploadFile(chunks)
         if response.length != len(raw):
             raise IOError("Raw Bytes failed to upload")
+        self._record_transfer(len(raw), time.time() - tstart)
+
+    @protect_grpc
+    def _upload_raw_on_new_channel(self, raw: bytes, save_as: str) -> None:
+        """Upload a binary string as a file through a dedicated channel.
+
+        Used from another thread while a request of this instance is
+        running, for example to cancel a solution. It does not use the
+        stub nor any other state of this instance.
+        """
+        channel = self._create_channel(*self._channel_str.rsplit(":", 1))
+        try:
+            stub = mapdl_grpc.MapdlServiceStub(channel)
+            response = stub.UploadFile(chunk_raw(raw, save_as))
+        finally:
+            channel.close()
+
+        if response.length != len(raw):
+            raise IOError("Raw Bytes failed to upload")
 
     # TODO: not fully tested/implemented
     @protect_grpc
     def Param(self, pname):
+        self._flush_batch()
         presponse = self._stub.GetParameter(pb_types.ParameterRequest(name=pname))
         return presponse.val
 
     # TODO: not fully tested/implemented
     @protect_grpc
     def Var(self, num):
+        self._flush_batch()
         presponse = self._stub.GetVariable(pb_types.VariableRequest(inum=num))
         return presponse.val
 
@@ -2689,12 +3744,14 @@ class MapdlGrpc(MapdlBase):
 
         APDLMATH vectors only.
         """
+        self._flush_batch()
         request = pb_types.ParameterRequest(name=pname)
         return self._stub.GetDataInfo(request)
 
     @protect_grpc
     def _vec_data(self, pname):
         """Downloads vector data from a MAPDL MATH parameter"""
+        self._flush_batch()
         dtype = ANSYS_VALUE_TYPE[self._data_info(pname).stype]
         request = pb_types.ParameterRequest(name=pname)
         chunks = self._stub.GetVecData(request)
@@ -2703,6 +3760,7 @@ class MapdlGrpc(MapdlBase):
     @protect_grpc
     def _mat_data(self, pname, raw=False):
         """Downloads matrix data from a parameter and returns a scipy sparse array"""
+        self._flush_batch()
         try:
             from scipy import sparse
         except ImportError:  # pragma: no cover
@@ -3299,7 +4357,9 @@ class MapdlGrpc(MapdlBase):
         id_ = uuid4()
         id_ = str(id_)[:31].replace("-", "")
         self._session_id_ = id_
+        self._last_session_check = 0.0
         self._run(f"{SESSION_ID_NAME}='{id_}'")
+        self._run(f"{SESSION_KEY_NAME}={_session_key(id_)}")
 
     @property
     def _session_id(self):
@@ -3307,8 +4367,21 @@ class MapdlGrpc(MapdlBase):
         return self._session_id_
 
     def _check_session_id(self):
-        """Verify that the local session ID matches the remote MAPDL session ID."""
-        if self._checking_session_id_ or not self._strict_session_id_check:
+        """Verify that the local session ID matches the remote MAPDL session ID.
+
+        The check reads the numeric session key with one ``GetParameter``
+        request, and it is done at most once every
+        ``_session_check_interval`` seconds, so consecutive commands do not
+        add a request each.  Hence, if another client takes over the MAPDL
+        session, the commands sent before the interval has passed are not
+        checked.  Once a mismatch is found, every command is checked until
+        the session IDs match again.
+        """
+        if (
+            self._checking_session_id_
+            or not self._strict_session_id_check
+            or (self._batching and not self._flushing_batch)
+        ):
             # To avoid recursion error
             return
 
@@ -3317,22 +4390,35 @@ class MapdlGrpc(MapdlBase):
             # We return early if pymapdl_session is not fixed yet.
             return
 
-        self._checking_session_id_ = True
-        self._mapdl_session_id = self._get_mapdl_session_id()
+        now = time.time()
+        if now - self._last_session_check < self._session_check_interval:
+            return
 
-        self._checking_session_id_ = False
+        self._checking_session_id_ = True
+        try:
+            mapdl_session_key = self._get_mapdl_session_key()
+        finally:
+            self._checking_session_id_ = False
 
-        if pymapdl_session_id is None or self._mapdl_session_id is None:
+        if mapdl_session_key is None:
             return
-        elif pymapdl.RUNNING_TESTS or self._strict_session_id_check:
-            if pymapdl_session_id != self._mapdl_session_id:
-                self._log.error("The session ids do not match")
 
-            else:
-                self._log.debug("The session ids match")
-                return True
+        self._last_session_check = now
+        match = mapdl_session_key == _session_key(pymapdl_session_id)
+        if match:
+            self._log.debug("The session ids match")
         else:
-            return pymapdl_session_id == self._mapdl_session_id
+            self._log.error("The session ids do not match")
+            # Check again on the next command
+            self._last_session_check = 0.0
+        return match
+
+    def _get_mapdl_session_key(self) -> Optional[int]:
+        """Retrieve the MAPDL session key with a binary parameter request."""
+        value = self.scalar_param(SESSION_KEY_NAME)
+        if value is None:
+            return None
+        return int(value)
 
     def _get_mapdl_session_id(self):
         """Retrieve MAPDL session ID."""
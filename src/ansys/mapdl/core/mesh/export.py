@@ -0,0 +1,362 @@
+# Copyright (C) 2024 ANSYS, Inc. and/or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+"""Stream the mesh from MAPDL to VTU and VTKHDF files in bounded memory."""
+import os
+import shutil
+import sys
+import tempfile
+
+from ansys.mapdl.reader import _reader
+import numpy as np
+
+from ansys.mapdl.core.mesh.mesh import _targe170_type_ref, _vtk_type_ref
+
+VTU_EXTENSIONS = (".vtu",)
+HDF5_EXTENSIONS = (".hdf", ".h5", ".hdf5", ".vtkhdf")
+
+# Quadratic VTK cell types, with their linear cell type and number of nodes
+QUADRATIC_TYPES = [21, 22, 23, 24, 25, 26, 27]
+LINEAR_TYPE = np.arange(256, dtype=np.uint8)
+LINEAR_TYPE[QUADRATIC_TYPES] = [3, 5, 9, 10, 12, 13, 14]
+N_LINEAR_NODES = np.zeros(256, np.int64)
+N_LINEAR_NODES[QUADRATIC_TYPES] = [2, 3, 4, 4, 8, 6, 5]
+
+# Arrays written to the files as (section, name, dtype, number of components)
+ARRAYS = (
+    ("PointData", "ansys_node_num", np.int32, 1),
+    ("CellData", "ansys_elem_num", np.int32, 1),
+    ("CellData", "ansys_real_constant", np.int32, 1),
+    ("CellData", "ansys_material_type", np.int32, 1),
+    ("CellData", "ansys_etype", np.int32, 1),
+    ("CellData", "ansys_elem_type_num", np.int32, 1),
+    ("Points", "Points", np.float64, 3),
+    ("Cells", "connectivity", np.int64, 1),
+    ("Cells", "offsets", np.int64, 1),
+    ("Cells", "types", np.uint8, 1),
+)
+
+VTK_TYPES = {
+    np.dtype(np.int32): "Int32",
+    np.dtype(np.int64): "Int64",
+    np.dtype(np.uint8): "UInt8",
+    np.dtype(np.float64): "Float64",
+}
+
+HDF5_NAMES = {
+    "connectivity": "Connectivity",
+    "offsets": "Offsets",
+    "types": "Types",
+}
+
+
+class VTUWriter:
+    """Write an unstructured grid to an appended-binary VTU file.
+
+    Each array is streamed to its own temporary file, since the XML
+    header must contain the size of every array.  The arrays are then
+    copied one after the other in the appended data section.
+    """
+
+    def __init__(self, filename):
+        self._filename = str(filename)
+        self._files = {name: tempfile.TemporaryFile() for _, name, _, _ in ARRAYS}
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        for fid in self._files.values():
+            fid.close()
+
+    def append(self, name, array):
+        """Append values to an array."""
+        dtype = next(dtype for _, name_, dtype, _ in ARRAYS if name_ == name)
+        self._files[name].write(np.ascontiguousarray(array, dtype).data)
+
+    def close(self, n_points, n_cells, n_connectivity):
+        """Write the file."""
+        byte_order = "LittleEndian" if sys.byteorder == "little" else "BigEndian"
+        lines = [
+            '<?xml version="1.0"?>',
+            '<VTKFile type="UnstructuredGrid" version="1.0" '
+            f'byte_order="{byte_order}" header_type="UInt64">',
+            "  <UnstructuredGrid>",
+            f'    <Piece NumberOfPoints="{n_points}" NumberOfCells="{n_cells}">',
+        ]
+
+        offset = 0
+        section = None
+        for section_, name, dtype, n_components in ARRAYS:
+            if section_ != section:
+                if section is not None:
+                    lines.append(f"      </{section}>")
+                lines.append(f"      <{section_}>")
+                section = section_
+
+            lines.append(
+                f'        <DataArray type="{VTK_TYPES[np.dtype(dtype)]}" '
+                f'Name="{name}" NumberOfComponents="{n_components}" '
+                f'format="appended" offset="{offset}"/>'
+            )
+            offset += 8 + self._files[name].tell()  # UInt64 size header
+
+        lines.append(f"      </{section}>")
+        lines += [
+            "    </Piece>",
+            "  </UnstructuredGrid>",
+            '  <AppendedData encoding="raw">',
+        ]
+
+        with open(self._filename, "wb") as out:
+            out.write(("\n".join(lines) + "\n   _").encode())
+            for _, name, _, _ in ARRAYS:
+                fid = self._files[name]
+                out.write(np.uint64(fid.tell()).tobytes())
+                fid.seek(0)
+                shutil.copyfileobj(fid, out)
+            out.write(b"\n  </AppendedData>\n</VTKFile>\n")
+
+
+class HDF5Writer:
+    """Write an unstructured grid to a VTKHDF file.
+
+    Each array is a resizable HDF5 dataset, extended at each append.
+    """
+
+    def __init__(self, filename):
+        try:
+            import h5py
+        except ModuleNotFoundError:
+            raise ModuleNotFoundError(
+                "To stream the mesh to an HDF5 file, the package 'h5py' is required.\n"
+                "Please try to install 'h5py' with:\npip install h5py"
+            )
+
+        self._filename = str(filename)
+        self._file = h5py.File(self._filename, "w")
+        self._root = self._file.create_group("VTKHDF")
+        self._root.attrs["Version"] = np.array([1, 0])
+        # VTK requires a fixed length string
+        self._root.attrs["Type"] = np.bytes_("UnstructuredGrid")
+
+        self._datasets = {}
+        for section, name, dtype, n_components in ARRAYS:
+            group = self._root
+            if section in ["PointData", "CellData"]:
+                group = self._root.require_group(section)
+
+            shape = (0, n_components) if n_components > 1 else (0,)
+            self._datasets[name] = group.create_dataset(
+                HDF5_NAMES.get(name, name),
+                shape,
+                dtype,
+                maxshape=(None,) + shape[1:],
+                chunks=True,
+            )
+
+        # VTKHDF offsets include the start of the first cell
+        self.append("offsets", [0])
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, *args):
+        if self._file:
+            self._file.close()
+            self._file = None
+            if exc_type is not None:
+                os.remove(self._filename)
+
+    def append(self, name, array):
+        """Append values to an array."""
+        dataset = self._datasets[name]
+        array = np.asarray(array, dataset.dtype)
+        size = dataset.shape[0]
+        dataset.resize(size + array.shape[0], axis=0)
+        dataset[size:] = array
+
+    def close(self, n_points, n_cells, n_connectivity):
+        """Write the file."""
+        self._root["NumberOfPoints"] = [n_points]
+        self._root["NumberOfCells"] = [n_cells]
+        self._root["NumberOfConnectivityIds"] = [n_connectivity]
+        self._file.close()
+        self._file = None
+
+
+def _vtk_cells(elem, elem_off, type_ref, nnum, force_linear, null_unallowed):
+    """Convert a batch of ANSYS elements to VTK cells.
+
+    Missing midside nodes point to the first node of their cell, since
+    new nodes cannot be added once the nodes have been written.
+
+    Returns
+    -------
+    valid : np.ndarray
+        Mask of the elements written as cells.
+    connectivity : np.ndarray
+        Point indices of the cells.
+    offsets : np.ndarray
+        End of each cell in ``connectivity``.
+    celltypes : np.ndarray
+        VTK cell types.
+    """
+    offset, celltypes, cells = _reader.ans_vtk_convert(
+        elem, elem_off, type_ref, nnum, True
+    )
+    offset = np.asarray(offset, np.int64)
+    celltypes = np.asarray(celltypes, np.uint8)
+    first = offset + 1  # first node of each cell
+    sizes = cells[offset].astype(np.int64)
+
+    missing = np.nonzero(cells == -1)[0]
+    if missing.size:
+        cell_ids = np.searchsorted(offset, missing, "right") - 1
+        cells[missing] = cells[first[cell_ids]]
+
+    if force_linear:
+        quadratic = LINEAR_TYPE[celltypes] != celltypes
+        sizes = np.where(quadratic, N_LINEAR_NODES[celltypes], sizes)
+        celltypes = LINEAR_TYPE[celltypes]
+
+    if null_unallowed:
+        valid = np.ones(celltypes.size, np.bool_)
+    else:
+        valid = celltypes != 0
+        first, sizes, celltypes = first[valid], sizes[valid], celltypes[valid]
+
+    offsets = np.cumsum(sizes)
+    n_connectivity = offsets[-1] if offsets.size else 0
+    gather = np.repeat(first - offsets + sizes, sizes) + np.arange(n_connectivity)
+    return valid, cells[gather], offsets, celltypes
+
+
+def save_stream(
+    filename,
+    mesh,
+    nodes,
+    elements,
+    allowable_types=None,
+    force_linear=False,
+    null_unallowed=False,
+):
+    """Write a mesh streamed from MAPDL to a VTU or VTKHDF file.
+
+    Parameters
+    ----------
+    filename : str, pathlib.Path
+        Filename of output file.  Appended-binary VTU is written for
+        ``".vtu"`` and VTKHDF for ``".hdf"``, ``".h5"``, ``".hdf5"``
+        and ``".vtkhdf"``.
+
+    mesh : ansys.mapdl.core.mesh_grpc.MeshGrpc
+        Mesh providing the node and element numbers, and the element
+        types.
+
+    nodes : iterable
+        Batches of node coordinates with shape ``(n, 3)``.
+
+    elements : iterable
+        Batches of complete elements and their offsets.  See
+        :func:`MeshGrpc._iter_elements()
+        <ansys.mapdl.core.mesh_grpc.MeshGrpc._iter_elements>`.
+
+    allowable_types : list, optional
+        Allowable element types.
+
+    force_linear : bool, optional
+        Write the quadratic cells as linear cells.
+
+    null_unallowed : bool, optional
+        Write the elements types not matching element types as empty
+        (null) cells.
+    """
+    ext = os.path.splitext(str(filename))[1].lower()
+    if ext in VTU_EXTENSIONS:
+        writer_class = VTUWriter
+    elif ext in HDF5_EXTENSIONS:
+        writer_class = HDF5Writer
+    else:
+        raise ValueError(
+            f"Invalid file extension '{ext}'.  Streaming supports "
+            f"{', '.join(VTU_EXTENSIONS + HDF5_EXTENSIONS)}."
+        )
+
+    nnum = np.ascontiguousarray(mesh.nnum, np.int32)
+    enum = np.asarray(mesh.enum, np.int32)
+    ekey = mesh._ekey
+
+    # The TARGE170 cell types are mapped from the shape key of the
+    # elements of each batch, since ``mesh.tshape_key`` loads them all
+    type_ref = _vtk_type_ref(mesh, allowable_types, tshape_key={})
+    targe170 = ekey[ekey[:, 1] == 170, 0]
+    if allowable_types is not None and 200 not in allowable_types:
+        targe170 = targe170[:0]  # mapped as the other element types
+
+    # element type reference number to ANSYS element type
+    etype_ref = np.zeros(type_ref.size, np.int32)
+    etype_ref[ekey[:, 0]] = ekey[:, 1]
+
+    with writer_class(filename) as writer:
+        n_points = 0
+        for points in nodes:
+            writer.append("Points", points)
+            n_points += points.shape[0]
+        writer.append("ansys_node_num", nnum)
+
+        n_cells = 0
+        n_connectivity = 0
+        ielem = 0
+        for elem, elem_off in elements:
+            if targe170.size:
+                heads = elem_off[:-1]
+                etype_ind, tshape_num = elem[heads + 1], elem[heads + 7]
+                is_targe170 = np.isin(etype_ind, targe170)
+                _targe170_type_ref(
+                    type_ref, etype_ind[is_targe170], tshape_num[is_targe170]
+                )
+
+            valid, connectivity, offsets, celltypes = _vtk_cells(
+                elem, elem_off, type_ref, nnum, force_linear, null_unallowed
+            )
+            writer.append("connectivity", connectivity)
+            writer.append("offsets", offsets + n_connectivity)
+            writer.append("types", celltypes)
+
+            # mat, type and real fields of the elements
+            fields = elem[elem_off[:-1][valid, np.newaxis] + np.arange(3)]
+            writer.append("ansys_elem_num", enum[ielem : ielem + valid.size][valid])
+            writer.append("ansys_real_constant", fields[:, 2])
+            writer.append("ansys_material_type", fields[:, 0])
+            writer.append("ansys_etype", fields[:, 1])
+            writer.append("ansys_elem_type_num", etype_ref[fields[:, 1]])
+
+            ielem += valid.size
+            n_cells += celltypes.size
+            n_connectivity += connectivity.size
+
+        if not n_points or not n_cells:
+            raise ValueError("The mesh is empty, hence no file has been written.")
+
+        writer.close(n_points, n_cells, n_connectivity)
@@ -69,6 +69,10 @@ SHAPE_MAP = {  # from ELIST definition
     18: "",
     19: "PILO",
 }
+# MESH200 key option to VTK conversion as an array
+MESH200_TYPE = np.zeros(max(MESH200_MAP) + 1, np.int32)
+MESH200_TYPE[list(MESH200_MAP)] = list(MESH200_MAP.values())
+
 # element type to VTK conversion function call map
 # 0: skip
 # 1: Point
@@ -91,29 +95,26 @@ TARGE170_MAP = {
     "POINT": 1,  # Point
 }
 
+# TARGE170 shape key to VTK conversion as an array
+TARGE170_TYPE = np.array(
+    [TARGE170_MAP.get(SHAPE_MAP[tshape], 0) for tshape in range(20)], np.int32
+)
 
-def _parse_vtk(
-    mesh,
-    allowable_types=None,
-    force_linear=False,
-    null_unallowed=False,
-    fix_midside=True,
-    additional_checking=False,
-):
-    """Convert raw ANSYS nodes and elements to a VTK UnstructuredGrid
 
-    Parameters
-    ----------
-    fix_midside : bool, optional
-        Adds additional midside nodes when ``True``.  When
-        ``False``, missing ANSYS cells will simply point to the
-        first node.
+def _targe170_type_ref(type_ref, etype_ind, tshape_num):
+    """Map TARGE170 element type reference numbers from their shape key."""
+    # weird bug when 'PILO' can be 99 instead of 19.
+    type_ref[etype_ind] = TARGE170_TYPE[np.minimum(tshape_num, 19)]
 
-    """
-    if not mesh._has_nodes or not mesh._has_elements:
-        # warnings.warn('Missing nodes or elements.  Unable to parse to vtk')
-        return
 
+def _vtk_type_ref(mesh, allowable_types=None, tshape_key=None):
+    """Map the element type reference numbers of a mesh to VTK cell types.
+
+    Returns an array indexed by element type reference number, where
+    unallowed element types are mapped to ``0``.  The TARGE170 element
+    types are mapped from ``tshape_key``, which defaults to
+    ``mesh.tshape_key`` and requires all the elements.
+    """
     etype_map = ETYPE_MAP
     if allowable_types is not None:
         try:
@@ -131,29 +132,56 @@ def _parse_vtk(
         etype_map[allowable_types] = ETYPE_MAP[allowable_types]
 
     # ANSYS element type to VTK map
-    type_ref = np.empty(2 << 16, np.int32)  # 131072
-    type_ref[mesh._ekey[:, 0]] = etype_map[mesh._ekey[:, 1]]
+    ekey = mesh._ekey
+    type_ref = np.zeros(2 << 16, np.int32)  # 131072
+    type_ref[ekey[:, 0]] = etype_map[ekey[:, 1]]
 
     if allowable_types is None or 200 in allowable_types:
-        for etype_ind, etype in mesh._ekey:
-            # MESH200
-            if etype == 200 and etype_ind in mesh.key_option:
-                # keyoption 1 contains various cell types
-                # map them to the corresponding type (see elements.py)
-                mapped = MESH200_MAP[mesh.key_option[etype_ind][0][1]]
-                type_ref[etype_ind] = mapped
-
-            # TARGE170 specifics
-            if etype == 170:
-                # edge case where missing element within the tshape_key
-                if etype_ind not in mesh.tshape_key:  # pragma: no cover
-                    continue
-                tshape_num = mesh.tshape_key[etype_ind]
-                if tshape_num >= 19:  # weird bug when 'PILO' can be 99 instead of 19.
-                    tshape_num = 19
-                tshape_label = SHAPE_MAP[tshape_num]
-                type_ref[etype_ind] = TARGE170_MAP.get(tshape_label, 0)
+        # MESH200: keyoption 1 contains various cell types, map them
+        # to the corresponding type (see elements.py)
+        etype_ind = ekey[ekey[:, 1] == 200, 0]
+        if etype_ind.size:
+            key_option = mesh.key_option
+            etype_ind = etype_ind[np.isin(etype_ind, list(key_option))]
+            keyopt = np.array([key_option[each][0][1] for each in etype_ind], int)
+            type_ref[etype_ind] = MESH200_TYPE[keyopt]
+
+        # TARGE170: the cell type depends on the target shape
+        etype_ind = ekey[ekey[:, 1] == 170, 0]
+        if etype_ind.size:
+            if tshape_key is None:
+                tshape_key = mesh.tshape_key
+            # edge case where missing element within the tshape_key
+            etype_ind = etype_ind[np.isin(etype_ind, list(tshape_key))]
+            tshape_num = np.array([tshape_key[each] for each in etype_ind], int)
+            _targe170_type_ref(type_ref, etype_ind, tshape_num)
+
+    return type_ref
+
 
+def _parse_vtk(
+    mesh,
+    allowable_types=None,
+    force_linear=False,
+    null_unallowed=False,
+    fix_midside=True,
+    additional_checking=False,
+):
+    """Convert raw ANSYS nodes and elements to a VTK UnstructuredGrid
+
+    Parameters
+    ----------
+    fix_midside : bool, optional
+        Adds additional midside nodes when ``True``.  When
+        ``False``, missing ANSYS cells will simply point to the
+        first node.
+
+    """
+    if not mesh._has_nodes or not mesh._has_elements:
+        # warnings.warn('Missing nodes or elements.  Unable to parse to vtk')
+        return
+
+    type_ref = _vtk_type_ref(mesh, allowable_types)
     nodes, angles, nnum = mesh.nodes, mesh.node_angles, mesh.nnum
 
     offset, celltypes, cells = _reader.ans_vtk_convert(
@@ -196,7 +224,9 @@ def _parse_vtk(
             grid.point_data["angles"] = angles
 
     if not null_unallowed:
-        grid = grid.extract_cells(grid.celltypes != 0)
+        valid = grid.celltypes != 0
+        if not valid.all():
+            grid = grid.extract_cells(valid)
 
     if force_linear:
         # only run if the grid has points or cells
@@ -219,41 +249,71 @@ def fix_missing_midside(cells, nodes, celltypes, offset, angles, nnum):
     saved as a ``-1``.  If this is not corrected, VTK will segfault.
 
     This function creates missing midside nodes for the quadratic
-    elements.
+    elements.  Only the cells with missing midside nodes and the nodes
+    they use are processed, instead of copying the whole mesh.
     """
     # Check for missing midside nodes
     mask = cells == -1
     nnodes = nodes.shape[0]
-
-    nextra = mask.sum()
-    cells[mask] = np.arange(nnodes, nnodes + nextra)
-
-    nodes_new = np.empty((nnodes + nextra, 3))
-    nodes_new[:nnodes] = nodes
-    nodes_new[nnodes:] = 0  # otherwise, segfault disaster
+    nextra = np.count_nonzero(mask)
+
+    # Cells with missing midside nodes
+    cell_ids = np.nonzero(np.logical_or.reduceat(mask, offset))[0]
+
+    if cell_ids.size == offset.size:
+        # Every cell is affected, gathering them would only add work
+        sub_offset, sub_celltypes = offset, celltypes
+        sub_cells = cells.copy()
+        sub_cells[mask] = np.arange(nnodes, nnodes + nextra)
+        sub_nodes = np.zeros((nnodes + nextra, 3))  # otherwise, segfault disaster
+        sub_nodes[:nnodes] = nodes
+        n_used = nnodes
+    else:
+        starts = offset[cell_ids]
+        sizes = cells[starts] + 1
+
+        # Gather these cells in a smaller legacy cell array
+        sub_offset = np.zeros(cell_ids.size, cells.dtype)
+        np.cumsum(sizes[:-1], out=sub_offset[1:])
+        gather = np.repeat(starts - sub_offset, sizes) + np.arange(sizes.sum())
+        sub_cells = cells[gather]
+        sub_celltypes = np.ascontiguousarray(celltypes[cell_ids])
+
+        # Renumber the nodes used by these cells, with the missing
+        # midside nodes at the end
+        is_node = np.ones(sub_cells.size, np.bool_)
+        is_node[sub_offset] = False
+        sub_missing = sub_cells == -1
+        is_node &= ~sub_missing
+        node_ids = sub_cells[is_node]
+        is_used = np.zeros(nnodes, np.bool_)
+        is_used[node_ids] = True
+        used = np.nonzero(is_used)[0]
+        n_used = used.size
+        sub_cells[is_node] = np.cumsum(is_used)[node_ids] - 1
+        sub_cells[sub_missing] = np.arange(n_used, n_used + nextra)
+
+        sub_nodes = np.zeros((n_used + nextra, 3))
+        sub_nodes[:n_used] = nodes[used]
 
     # Set new midside nodes directly between their edge nodes
-    temp_nodes = nodes_new.copy()
-    _relaxmidside.reset_midside(cells, celltypes, offset, temp_nodes)
+    _relaxmidside.reset_midside(sub_cells, sub_celltypes, sub_offset, sub_nodes)
 
     # merge midside nodes
-    unique_nodes, idx_a, idx_b = unique_rows(temp_nodes[nnodes:])
+    unique_nodes, idx_a, idx_b = unique_rows(sub_nodes[n_used:])
 
     # rewrite node numbers
     cells[mask] = idx_b + nnodes
     nextra = idx_a.shape[0]  # extra unique nodes
-    nodes_new = nodes_new[: nnodes + nextra]
-    nodes_new[nnodes:] = unique_nodes
+    nodes_new = np.vstack((nodes, unique_nodes))
 
     if angles is not None:
-        new_angles = np.empty((nnodes + nextra, 3))
+        new_angles = np.zeros((nnodes + nextra, 3))
         new_angles[:nnodes] = angles
-        new_angles[nnodes:] = 0
     else:
         new_angles = None
 
     # Add extra node numbers
-    nnum_new = np.empty(nnodes + nextra)
+    nnum_new = np.full(nnodes + nextra, -1, np.int32)
     nnum_new[:nnodes] = nnum
-    nnum_new[nnodes:] = -1
     return nodes_new, new_angles, nnum_new
@@ -31,13 +31,22 @@ import weakref
 from ansys.api.mapdl.v0 import ansys_kernel_pb2 as anskernel
 import numpy as np
 
-from ansys.mapdl.core.common_grpc import DEFAULT_CHUNKSIZE, parse_chunks
+from ansys.mapdl.core.commands import CMD_SELECTION
+from ansys.mapdl.core.common_grpc import DEFAULT_CHUNKSIZE, iter_chunks, parse_chunks
 from ansys.mapdl.core.mapdl_grpc import MapdlGrpc
 from ansys.mapdl.core.misc import requires_package, supress_logging, threaded
 
 TMP_NODE_CM = "__NODE__"
 
 
+def _is_selection_command(command):
+    """Return ``True`` when ``command`` only changes the selection."""
+    if not command:
+        return False
+    name = command.split(",")[0].strip().upper()
+    return name[:4] in CMD_SELECTION
+
+
 def requires_model(output=None):
     def decorator(method):
         """
@@ -63,6 +72,149 @@ def requires_model(output=None):
     return decorator
 
 
+class ElementArrays:
+    """Compressed sparse row (CSR) view of the elements of a mesh.
+
+    The element attributes are stored as a contiguous ``(n_elem, 10)``
+    array and the nodes of all the elements as a single connectivity
+    array, where the nodes of the element in row ``i`` are
+    ``connectivity[offsets[i]:offsets[i + 1]]``.
+
+    It also behaves as a sequence of the raw ANSYS elements, where each
+    item is a view of the 10 element fields followed by its nodes.  Slicing
+    it returns a list of these views.
+
+    Examples
+    --------
+    >>> elements = mapdl.mesh.elem
+    >>> elements.material_type
+    array([1, 1, 1, ..., 1, 1, 1], dtype=int32)
+
+    Nodes of the element number 10.
+
+    >>> elements.nodes(elements.row(10))
+    array([18, 19, 26, 25], dtype=int32)
+
+    """
+
+    def __init__(self, elem, elem_off):
+        """Initialize from the raw element array and its offsets."""
+        elem = np.asarray(elem, dtype=np.int32)
+        self._elem = elem
+        self._elem_off = np.asarray(elem_off, dtype=np.int64)
+
+        heads = self._elem_off[:-1]
+        # column major, so each attribute is contiguous
+        self._attributes = np.asfortranarray(elem[heads[:, np.newaxis] + np.arange(10)])
+
+        n_nodes = np.diff(self._elem_off) - 10
+        self._offsets = np.zeros(heads.size + 1, np.int64)
+        np.cumsum(n_nodes, out=self._offsets[1:])
+
+        is_node = np.ones(elem.size, np.bool_)
+        is_node[heads[:, np.newaxis] + np.arange(10)] = False
+        self._connectivity = elem[is_node]
+
+        self._index = None
+
+    def __len__(self):
+        return self._attributes.shape[0]
+
+    def __getitem__(self, index):
+        """Raw element ``index``: its 10 fields followed by its nodes."""
+        if isinstance(index, slice):
+            return [self[each] for each in range(*index.indices(len(self)))]
+        if not isinstance(index, (int, np.integer)):
+            raise TypeError("Element index must be an integer or a slice")
+        if index < 0:
+            index += len(self)
+        if not 0 <= index < len(self):
+            raise IndexError("Element index out of range")
+        return self._elem[self._elem_off[index] : self._elem_off[index + 1]]
+
+    def __iter__(self):
+        for index in range(len(self)):
+            yield self[index]
+
+    def __repr__(self):
+        return f"ElementArrays with {len(self)} elements"
+
+    @property
+    def attributes(self) -> np.ndarray:
+        """Element fields with shape ``(n_elem, 10)``.
+
+        See :attr:`MeshGrpc.elem <ansys.mapdl.core.mesh_grpc.MeshGrpc.elem>`
+        for the description of each field.
+        """
+        return self._attributes
+
+    @property
+    def offsets(self) -> np.ndarray:
+        """Offsets of the nodes of each element in ``connectivity``."""
+        return self._offsets
+
+    @property
+    def connectivity(self) -> np.ndarray:
+        """Nodes of all the elements in ANSYS numbering."""
+        return self._connectivity
+
+    @property
+    def material_type(self) -> np.ndarray:
+        """FIELD 0 : material reference number"""
+        return self._attributes[:, 0]
+
+    @property
+    def element_type(self) -> np.ndarray:
+        """FIELD 1 : element type number"""
+        return self._attributes[:, 1]
+
+    @property
+    def real_constant(self) -> np.ndarray:
+        """FIELD 2 : real constant reference number"""
+        return self._attributes[:, 2]
+
+    @property
+    def section(self) -> np.ndarray:
+        """FIELD 3 : section number"""
+        return self._attributes[:, 3]
+
+    @property
+    def coord_system(self) -> np.ndarray:
+        """FIELD 4 : element coordinate system"""
+        return self._attributes[:, 4]
+
+    @property
+    def shape(self) -> np.ndarray:
+        """FIELD 7 : coded shape key"""
+        return self._attributes[:, 7]
+
+    @property
+    def enum(self) -> np.ndarray:
+        """FIELD 8 : element number"""
+        return self._attributes[:, 8]
+
+    def row(self, enum):
+        """Row of the element numbers ``enum``.
+
+        The lookup uses an index array built on the first call, hence
+        it takes constant time per element.  Missing elements return
+        ``-1``.
+        """
+        if self._index is None:
+            index_size = self.enum.max() + 1 if len(self) else 1
+            self._index = np.full(index_size, -1, np.int64)
+            self._index[self.enum] = np.arange(len(self))
+
+        enum = np.asarray(enum)
+        valid = (enum >= 0) & (enum < self._index.size)
+        rows = np.where(valid, self._index[np.where(valid, enum, 0)], -1)
+        return int(rows) if rows.ndim == 0 else rows
+
+    def nodes(self, row):
+        """Nodes of the element in row ``row``."""
+        return self._connectivity[self._offsets[row] : self._offsets[row + 1]]
+
+
 class MeshGrpc:
     """Provides an interface to the gRPC mesh from MAPDL."""
 
@@ -100,6 +252,13 @@ class MeshGrpc:
             self._surf_cache = self._grid.extract_surface()
         return self._surf_cache
 
+    @property
+    def _linear_surf(self):
+        """Cleaned external surface of the linear grid, as plotted by ``eplot``"""
+        if self._linear_surf_cache is None:
+            self._linear_surf_cache = self._grid.linear_copy().extract_surface().clean()
+        return self._linear_surf_cache
+
     @property
     def _has_nodes(self):
         """Returns True when has nodes"""
@@ -116,37 +275,38 @@ class MeshGrpc:
         """Wraps set_log_level"""
         self._mapdl._set_log_level(level)
 
-    def _reset_cache(self):
-        """Reset entire mesh cache"""
+    def _reset_cache(self, command=None):
+        """Reset entire mesh cache.
+
+        The grid of the whole model is kept when ``command`` only changes
+        the selection, since the selected grid is extracted from it.
+        """
         if not self._ignore_cache_reset:
             self.logger.debug("Resetting cache")
 
+            if not _is_selection_command(command):
+                self._full_grid_cache = None
+
             self._cache_elem = None
             self._cache_elem_off = None
             self._cache_element_desc = None
             self._cache_nnum = None
-            self._cached_elements = None  # cached list of elements
+            self._cached_elements = None  # cached CSR element arrays
             self._chunk_size = None
             self._elem = None
             self._elem_off = None
             self._enum = None  # cached element numbering
-            self._esys = None  # cached element coordinate system
             self._etype = None
-            self._etype_cache = None  # cached ansys element type numbering
-            self._etype_id = None  # cached element type id
             self._grid = None
             self._grid_cache = None
             self._keyopt = {}
-            self._mtype = None  # cached ansys material type
             self._nnum = None
             self._node_angles = None  # cached node angles
             self._node_coord = None  # cached node coordinates
-            self._rcon = None  # cached ansys element real constant
             self._rdat = None
             self._rnum = None
-            self._secnum = None  # cached section number
             self._surf_cache = None
-            self._tshape = None
+            self._linear_surf_cache = None
             self._tshape_key = None
 
     def _update_cache(self):
@@ -232,9 +392,7 @@ class MeshGrpc:
     @property
     def _ans_etype(self):
         """FIELD 1 : element type number"""
-        if self._etype_cache is None:
-            self._etype_cache = self._elem[self._elem_off[:-1] + 1]
-        return self._etype_cache
+        return self._elements.element_type
 
     @property
     def local(self):
@@ -244,19 +402,13 @@ class MeshGrpc:
     @requires_model()
     def et_id(self):
         """Element type id (ET) for each element."""
-        if self._etype_id is None:
-            etype_elem_id = self._elem_off[:-1] + 1
-            self._etype_id = self._elem[etype_elem_id]
-        return self._etype_id
+        return self._elements.element_type
 
     @property
     @requires_model()
     def tshape(self):
         """Tshape of contact elements."""
-        if self._tshape is None:
-            shape_elem_id = self._elem_off[:-1] + 7
-            self._tshape = self._elem[shape_elem_id]
-        return self._tshape
+        return self._elements.shape
 
     @property
     @requires_model("dict")
@@ -266,17 +418,23 @@ class MeshGrpc:
         TShape is only applicable to contact elements.
         """
         if self._tshape_key is None:
-            self._tshape_key = np.unique(np.vstack((self.et_id, self.tshape)), axis=1).T
+            # unique pairs packed in one int64, much faster than unique columns
+            shift = np.int64(2**31)
+            pairs = np.unique(
+                (self.et_id.astype(np.int64) << 32)
+                + self.tshape.astype(np.int64)
+                + shift
+            )
+            self._tshape_key = np.column_stack(
+                (pairs >> 32, (pairs & 0xFFFFFFFF) - shift)
+            ).astype(np.int32)
         return {elem_id: tshape for elem_id, tshape in self._tshape_key}
 
     @property
     @requires_model()
     def material_type(self):
         """Material type index of each element in the archive."""
-        # FIELD 0 : material reference number
-        if self._mtype is None:
-            self._mtype = self._elem[self._elem_off[:-1]]
-        return self._mtype
+        return self._elements.material_type
 
     @property
     @requires_model()
@@ -302,22 +460,21 @@ class MeshGrpc:
     @requires_model()
     def section(self):
         """Section number"""
-        if self._secnum is None:
-            self._secnum = self._elem[self._elem_off[:-1] + 3]  # FIELD 3
-        return self._secnum
+        return self._elements.section
 
     @property
     @requires_model()
     def element_coord_system(self):
         """Element coordinate system number"""
-        if self._esys is None:
-            self._esys = self._elem[self._elem_off[:-1] + 4]  # FIELD 4
-        return self._esys
+        return self._elements.coord_system
 
     @property
-    @requires_model("list")
-    def elem(self):
-        """List of elements containing raw ansys information.
+    def elem(self) -> ElementArrays:
+        """Elements containing raw ansys information.
+
+        The elements are stored as compressed sparse row (CSR) arrays,
+        see :class:`ElementArrays <ansys.mapdl.core.mesh_grpc.ElementArrays>`,
+        which can also be used as a list of elements.
 
         Each element contains 10 items plus the nodes belonging to the
         element.  The first 10 items are:
@@ -335,8 +492,15 @@ class MeshGrpc:
         - FIELDS 10 - 30 : The nodes belonging to the element in ANSYS numbering.
 
         """
+        if not (self._has_nodes and self._has_elements):
+            return ElementArrays(np.empty(0, np.int32), np.zeros(1, np.int64))
+        return self._elements
+
+    @property
+    def _elements(self):
+        """CSR element arrays."""
         if self._cached_elements is None:
-            self._cached_elements = np.split(self._elem, self._elem_off[1:-1])
+            self._cached_elements = ElementArrays(self._elem, self._elem_off)
         return self._cached_elements
 
     @property
@@ -367,10 +531,7 @@ class MeshGrpc:
         Use the data within ``rlblock`` and ``rlblock_num`` to get the
         real constant datat for each element.
         """
-        # FIELD 2 : real constant reference number
-        if self._rcon is None:
-            self._rcon = self._elem[self._elem_off[:-1] + 2]
-        return self._rcon
+        return self._elements.real_constant
 
     @property
     def ekey(self):
@@ -565,6 +726,7 @@ class MeshGrpc:
         np.ndarray
             Numpy array of nodes
         """
+        self._mapdl._flush_batch()
         if self._chunk_size:
             chunk_size = self._chunk_size
 
@@ -573,6 +735,36 @@ class MeshGrpc:
         nodes = parse_chunks(chunks, np.double).reshape(-1, 3)
         return nodes
 
+    def _iter_nodes(self, chunk_size=DEFAULT_CHUNKSIZE):
+        """Stream the node coordinates from the server.
+
+        Parameters
+        ----------
+        chunk_size : int
+            Size of the chunks to request from the server.  Default
+            256 kB
+
+        Yields
+        ------
+        np.ndarray
+            Coordinates of the nodes of each chunk with shape ``(n, 3)``.
+        """
+        self._mapdl._flush_batch()
+        if self._chunk_size:
+            chunk_size = self._chunk_size
+
+        request = anskernel.StreamRequest(chunk_size=chunk_size)
+        rest = np.empty(0)
+        for array in iter_chunks(self._mapdl._stub.Nodes(request), np.double):
+            if rest.size:
+                array = np.concatenate((rest, array))
+
+            # chunks are not aligned with the nodes
+            n_values = array.size - array.size % 3
+            rest = array[n_values:]
+            if n_values:
+                yield array[:n_values].reshape(-1, 3)
+
     def _update_cache_elem(self):
         """Update the element and element offset cache"""
         if self._cache_elem is None:
@@ -639,6 +831,7 @@ class MeshGrpc:
             Array of indices indicating the start of each element.
 
         """
+        self._mapdl._flush_batch()
         if self._chunk_size:
             chunk_size = self._chunk_size
 
@@ -664,6 +857,78 @@ class MeshGrpc:
         elems_[indx_elem] = self.enum
         return elems_, offset
 
+    def _iter_elements(self, chunk_size=DEFAULT_CHUNKSIZE):
+        """Stream the elements from the server.
+
+        Only complete elements are returned, so each batch can be
+        converted independently.  See :func:`MeshGrpc._load_elements_offset`
+        for the layout of the elements.
+
+        Parameters
+        ----------
+        chunk_size : int, optional
+            Size of the chunks to request from the server.
+
+        Yields
+        ------
+        elements : np.ndarray
+            Array of the elements of the batch.
+
+        offset : np.ndarray
+            Array of indices indicating the start of each element in
+            the batch, followed by the size of ``elements``.
+
+        """
+        self._mapdl._flush_batch()
+        if self._chunk_size:
+            chunk_size = self._chunk_size
+
+        request = anskernel.StreamRequest(chunk_size=chunk_size)
+        chunks = iter_chunks(self._mapdl._stub.LoadElements(request), np.int32)
+
+        # The stream starts with ``n_elem`` offsets, where the first one
+        # is ``n_elem`` itself.  Wait for all of them.
+        header = []
+        n_header = 0
+        for array in chunks:
+            if not array.size:
+                continue
+            header.append(array)
+            n_header += array.size
+            if n_header and n_header >= header[0][0]:
+                break
+
+        if not n_header:  # for empty mesh.
+            return
+
+        buffer = np.concatenate(header)
+        n_elem = buffer[0]
+        starts = buffer[:n_elem]
+        starts = starts[starts != 0].astype(np.int64) - n_elem
+        buffer = buffer[n_elem:]
+
+        # global position of the buffer and first element in the buffer
+        position = 0
+        ielem = 0
+        for array in chunks:
+            buffer = np.concatenate((buffer, array)) if buffer.size else array
+
+            # elements before ``last`` are complete
+            last = np.searchsorted(starts, position + buffer.size, "right") - 1
+            if last > ielem:
+                cut = starts[last] - position
+                yield (
+                    buffer[:cut].copy(),  # chunks are read-only
+                    (starts[ielem : last + 1] - position).astype(np.int32),
+                )
+                buffer = buffer[cut:]
+                position += cut
+                ielem = last
+
+        if ielem < starts.size:
+            offset = np.append(starts[ielem:] - position, buffer.size)
+            yield buffer.copy(), offset.astype(np.int32)
+
     def _load_element_types(self, chunk_size=DEFAULT_CHUNKSIZE):
         """Loads element types from the MAPDL server.
 
@@ -677,6 +942,7 @@ class MeshGrpc:
         int
             Size of the chunks to request from the server.
         """
+        self._mapdl._flush_batch()
         request = anskernel.StreamRequest(chunk_size=chunk_size)
         chunks = self._mapdl._stub.LoadElementTypeDescription(request)
         data = parse_chunks(chunks, np.int32)
@@ -736,10 +1002,50 @@ class MeshGrpc:
     @requires_package("pyvista")
     def _grid(self):
         if self._grid_cache is None:
-            self._update_cache()
-            self._grid_cache = self._parse_vtk(force_linear=True)
+            self._grid_cache = self._selected_grid()
         return self._grid_cache
 
+    @property
+    def _full_grid(self):
+        """Grid of the whole model.
+
+        It is kept while only selection commands are run.
+        """
+        if self._full_grid_cache is None:
+            self.logger.debug("Updating full grid cache")
+            with self._mapdl.save_selection:
+                self._mapdl.allsel(mute=True)
+                self._update_cache()
+                self._full_grid_cache = self._parse_vtk(force_linear=True)
+        return self._full_grid_cache
+
+    def _selected_grid(self):
+        """Extract the grid of the selected elements from the full grid.
+
+        Only the element selection status is requested to MAPDL.
+        """
+        grid = self._full_grid
+        if grid is None:
+            return None
+
+        esel = self._mapdl.get_array("ELEM", item1="ESEL")
+        enum = grid.cell_data["ansys_elem_num"]
+
+        mask = np.zeros(enum.size, np.bool_)
+        valid = (enum > 0) & (enum <= esel.size)
+        mask[valid] = esel[enum[valid] - 1] == 1
+
+        if mask.all():
+            return grid.copy()
+        elif not mask.any():
+            return None
+
+        grid = grid.extract_cells(mask)
+        ind = np.arange(grid.n_points)
+        grid.point_data["origid"] = ind
+        grid.point_data["VTKorigID"] = ind
+        return grid
+
     @_grid.setter
     def _grid(self, value):
         self._grid_cache = value
@@ -751,6 +1057,7 @@ class MeshGrpc:
         force_linear=False,
         allowable_types=None,
         null_unallowed=False,
+        stream=False,
     ):
         """Save the geometry as a vtk file
 
@@ -779,11 +1086,50 @@ class MeshGrpc:
             as empty (null) elements.  Useful for debug or tracking
             element numbers.  Default False.
 
+        stream : bool, optional
+            Write the nodes and elements to the file as they are
+            streamed from MAPDL, without building the grid in memory.
+            Only the node and element numbers are kept in memory.  The
+            file is always binary and its type is given by the extension
+            of the filename: ``".vtu"`` for an appended-binary VTU file,
+            or ``".hdf"``, ``".h5"``, ``".hdf5"`` and ``".vtkhdf"`` for a
+            VTKHDF file, which requires ``h5py``.  Default False.
+
         Notes
         -----
         Binary files write much faster than ASCII and have a smaller
         file size.
+
+        When streaming, the nodes of the selected elements are written,
+        as when the grid is built.  Missing midside nodes are not added.
+        They point to the first node of their cell instead.
+
+        Examples
+        --------
+        Save a mesh larger than the client memory.
+
+        >>> mapdl.mesh.save("mesh.vtu", stream=True)
+
         """
+        if stream:
+            from ansys.mapdl.core.mesh.export import save_stream
+
+            if not self.n_node or not self.n_elem:
+                raise ValueError("The mesh is empty, hence no file has been written.")
+
+            # select the nodes of the selected elements, as the grid does
+            with self._mapdl.save_selection:
+                self._mapdl.nsle("S", mute=True)
+                return save_stream(
+                    filename,
+                    self,
+                    self._iter_nodes(),
+                    self._iter_elements(),
+                    allowable_types=allowable_types,
+                    force_linear=force_linear,
+                    null_unallowed=null_unallowed,
+                )
+
         grid = self._parse_vtk(
             allowable_types=allowable_types,
             force_linear=force_linear,
@@ -23,6 +23,7 @@
 """Module for miscellaneous functions and methods"""
 from enum import Enum
 from functools import wraps
+import hashlib
 import importlib
 import inspect
 import os
@@ -1107,6 +1108,32 @@ def write_array(filename: Union[str, bytes], array: np.ndarray):
     np.savetxt(filename, array, fmt="%20.12f")
 
 
+def file_checksum(
+    filename: str, algorithm: str = "sha256", chunk_size: int = 1024 * 1024
+) -> str:
+    """Return the hexadecimal digest of the content of a file.
+
+    Parameters
+    ----------
+    filename : str
+        Path to the file.
+    algorithm : str, optional
+        Any algorithm supported by :mod:`hashlib`. The default is ``"sha256"``.
+    chunk_size : int, optional
+        Size in bytes of the blocks read from the file. The default is 1 MB.
+
+    Returns
+    -------
+    str
+        Hexadecimal digest of the file content.
+    """
+    hash_ = hashlib.new(algorithm)
+    with open(filename, "rb") as fid:
+        for block in iter(lambda: fid.read(chunk_size), b""):
+            hash_.update(block)
+    return hash_.hexdigest()
+
+
 def requires_package(package_name, softerror=False):
     """
     Decorator check whether a package is installed or not.
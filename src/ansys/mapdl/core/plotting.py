@@ -35,6 +35,9 @@ from .theme import MapdlTheme
 
 POINT_SIZE = 10
 
+# Meshes with more cells are rendered coarser while interacting
+LOD_MIN_CELLS = 200_000
+
 # Supported labels
 BC_D = [
     "TEMP",
@@ -398,8 +401,11 @@ def _general_plotter(
         if not isinstance(mesh_, list):
             mesh_ = [mesh_]
 
+        # Only interactive windows need a level of detail
+        interactive = not plotter.off_screen and plotter.iren is not None
+
         for each_mesh in mesh_:
-            plotter.add_mesh(
+            actor = plotter.add_mesh(
                 each_mesh,
                 scalars=scalars,
                 scalar_bar_args=scalar_bar_args,
@@ -425,6 +431,10 @@ def _general_plotter(
                 **add_mesh_kwargs,
             )
 
+            n_cells = actor.GetMapper().GetInput().GetNumberOfCells()
+            if interactive and n_cells > LOD_MIN_CELLS:
+                _lod_actor(plotter, actor)
+
     for label in labels:
         # verify points are not duplicates
         points = np.atleast_2d(np.array(label["points"]))
@@ -457,6 +467,47 @@ def _general_plotter(
     return plotter
 
 
+def _lod_actor(plotter, actor):
+    """Replace an actor by one rendering a coarse proxy while interacting.
+
+    VTK builds the proxy by quadric clustering the first time the scene
+    is interacted with, so nothing is computed before the first render.
+    The full mesh is rendered again once the interaction stops.
+
+    The actors are swapped in the VTK renderer directly, because
+    ``Plotter.remove_actor`` would also remove the scalar bar of the
+    mapper.
+
+    Parameters
+    ----------
+    plotter : pyvista.Plotter
+        Plotter containing ``actor``.
+
+    actor : pyvista.Actor
+        Actor of the full mesh.
+
+    Returns
+    -------
+    vtkQuadricLODActor
+        Actor sharing the mapper and property of ``actor``.
+    """
+    from vtkmodules.vtkRenderingLOD import vtkQuadricLODActor
+
+    lod_actor = vtkQuadricLODActor()
+    lod_actor.SetMapper(actor.GetMapper())
+    lod_actor.SetProperty(actor.GetProperty())
+    lod_actor.DeferLODConstructionOn()
+    lod_actor.StaticOn()  # the mesh does not change
+
+    renderer = plotter.renderer
+    renderer.RemoveActor(actor)
+    renderer.AddActor(lod_actor)
+    actors = renderer.actors
+    for name in [name for name, each in actors.items() if each is actor]:
+        actors[name] = lod_actor
+    return lod_actor
+
+
 # Using * to force all the following arguments to be keyword only.
 def general_plotter(
     meshes,
@@ -25,8 +25,9 @@ import os
 import shutil
 import socket
 import tempfile
+import threading
 import time
-from typing import Any, Dict, List, Optional, Union
+from typing import Any, Dict, List, Optional, Tuple, Union
 import warnings
 import weakref
 
@@ -35,12 +36,20 @@ from ansys.mapdl.core.errors import MapdlRuntimeError, VersionError
 from ansys.mapdl.core.launcher import (
     LOCALHOST,
     MAPDL_DEFAULT_PORT,
+    PortReservation,
     check_valid_ip,
     get_start_instance,
     port_in_use,
+    reserve_ports,
 )
-from ansys.mapdl.core.mapdl_grpc import _HAS_TQDM
-from ansys.mapdl.core.misc import create_temp_dir, threaded, threaded_daemon
+from ansys.mapdl.core.mapdl_grpc import _HAS_TQDM, UNHEALTHY_CHANNEL_STATES
+from ansys.mapdl.core.misc import (
+    create_temp_dir,
+    file_checksum,
+    threaded,
+    threaded_daemon,
+)
+from ansys.mapdl.core.pool_metrics import PoolMetrics
 
 try:
     from ansys.tools.path import get_ansys_path, version_from_path
@@ -56,6 +65,9 @@ if _HAS_TQDM:
 else:
     DEFAULT_PROGRESS_BAR = False
 
+# Seconds between keep-alive requests to the idle remote instances
+KEEPALIVE_DELAY = 30
+
 
 def available_ports(n_ports: int, starting_port: int = MAPDL_DEFAULT_PORT) -> List[int]:
     """Return a list the first ``n_ports`` ports starting from ``starting_port``."""
@@ -215,6 +227,13 @@ class MapdlPool:
         """Initialize several instances of mapdl"""
         self._instances: List[None] = []
 
+        # Set by the instances when their health changes (channel failure,
+        # exit...) to wake up the pool monitor.
+        self._health_event = threading.Event()
+
+        # Ports held until their instance is launched {port: PortReservation}
+        self._port_reservations: Dict[int, PortReservation] = {}
+
         # Getting debug arguments
         _debug_no_launch = kwargs.pop("_debug_no_launch", None)
 
@@ -275,6 +294,12 @@ class MapdlPool:
                 "Only strings or functions are allowed in the argument 'name'."
             )
 
+        self._metrics = PoolMetrics(names=self._names)
+
+        # Shared files already in each instance working directory
+        # {instance index: {file name: checksum}}
+        self._shared_files_cache: Dict[int, Dict[str, str]] = {}
+
         # verify executable
         exec_file = os.getenv("PYMAPDL_MAPDL_EXEC", exec_file)
 
@@ -340,6 +365,7 @@ class MapdlPool:
                 "exec_file": exec_file,
                 "n_instances": n_instances,
             }
+            self._release_ports()
             return
 
         threads = [
@@ -405,6 +431,7 @@ class MapdlPool:
         close_when_finished=False,
         timeout=None,
         wait=True,
+        shared_files=None,
     ):
         """Run a function for each instance of mapdl within the pool.
 
@@ -438,6 +465,13 @@ class MapdlPool:
             Block execution until the batch is complete.  Default
             ``True``.
 
+        shared_files : list[str], optional
+            Local files needed by ``func``, for example include files,
+            CDB meshes or material libraries.  They are copied to the
+            working directory of each instance before running ``func``.
+            Files are identified by their content, hence a file is only
+            sent once to each instance, unless it changes.
+
         Returns
         -------
         list
@@ -481,6 +515,7 @@ class MapdlPool:
                 raise MapdlRuntimeError("No MAPDL instances available.")
 
         results = []
+        shared_files = self._checksum_shared_files(shared_files)
 
         if iterable is not None:
             n = len(iterable)
@@ -498,12 +533,15 @@ class MapdlPool:
             pbar = tqdm(total=n, desc="MAPDL Running")
 
         @threaded_daemon
-        def func_wrapper(obj, func, timeout, args=None):
+        def func_wrapper(obj, func, timeout, task, args=None):
             """Expect obj to be an instance of Mapdl"""
             complete = [False]
 
             @threaded_daemon
             def run():
+                if shared_files:
+                    self._sync_shared_files(obj, task.index, shared_files)
+
                 if args is not None:
                     if isinstance(args, (tuple, list)):
                         results.append(func(obj, *args))
@@ -547,19 +585,22 @@ class MapdlPool:
                                 )
 
             obj.locked = False
+            self._metrics.task_finished(task, success=complete[0])
             if pbar:
                 pbar.update(1)
 
         threads = []
         if iterable is not None:
             threads = []
-            for args in iterable:
+            tasks = [self._metrics.task_queued() for _ in iterable]
+            for args, task in zip(iterable, tasks):
                 # grab the next available instance of mapdl
-                instance = self.next_available()
+                instance, index = self.next_available(return_index=True)
                 instance.locked = True
+                self._metrics.task_started(task, index)
                 threads.append(
                     func_wrapper(
-                        instance, func, timeout, args, thread_name="Map_Thread"
+                        instance, func, timeout, task, args, thread_name="Map_Thread"
                     )
                 )
 
@@ -583,9 +624,11 @@ class MapdlPool:
                     [thread.join() for thread in threads]
 
         else:  # simply apply to all
-            for instance in self._instances:
+            for index, instance in enumerate(self._instances):
                 if instance:
-                    threads.append(func_wrapper(instance, func, timeout))
+                    task = self._metrics.task_queued()
+                    self._metrics.task_started(task, index)
+                    threads.append(func_wrapper(instance, func, timeout, task))
 
             # wait for all threads to complete
             if wait:
@@ -601,6 +644,7 @@ class MapdlPool:
         close_when_finished=False,
         timeout=None,
         wait=True,
+        shared_files=None,
     ):
         """Run a batch of input files on the pool.
 
@@ -636,6 +680,12 @@ class MapdlPool:
             Block execution until the batch is complete.  Default
             ``True``.
 
+        shared_files : list[str], optional
+            Local files referenced by the input files, for example
+            include files, CDB meshes or material libraries.  Each file
+            is sent only once to each instance and reused by the
+            following runs as long as its content does not change.
+
         Returns
         -------
         list
@@ -654,6 +704,10 @@ class MapdlPool:
         >>> outputs = pool.run_batch(files)
         >>> len(outputs)
         20
+
+        Run several input files which read the same mesh file.
+
+        >>> outputs = pool.run_batch(files, shared_files=["mesh.cdb"])
         """
         # check all files exist before running
         for filename in files:
@@ -673,8 +727,51 @@ class MapdlPool:
             timeout=timeout,
             wait=wait,
             close_when_finished=close_when_finished,
+            shared_files=shared_files,
         )
 
+    @staticmethod
+    def _checksum_shared_files(files) -> List[Tuple[str, str]]:
+        """Return the path and checksum of each shared file."""
+        if not files:
+            return []
+
+        if isinstance(files, str):
+            files = [files]
+
+        checksums = []
+        for filename in files:
+            if not os.path.isfile(filename):
+                raise FileNotFoundError("Unable to locate file %s" % filename)
+            checksums.append((str(filename), file_checksum(filename)))
+        return checksums
+
+    def _sync_shared_files(
+        self, mapdl, index: int, files: List[Tuple[str, str]]
+    ) -> None:
+        """Send the shared files which are not in the instance working directory yet.
+
+        The files already sent to an instance are tracked by name and checksum
+        in ``_shared_files_cache``.  The cache of an instance is reset when it
+        is respawned.
+        """
+        cache = self._shared_files_cache.setdefault(index, {})
+
+        for filename, checksum in files:
+            basename = os.path.basename(filename)
+            if cache.get(basename) == checksum:
+                continue
+
+            LOG.debug("Sending shared file '%s' to instance %d", basename, index)
+            if mapdl._local:
+                destination = os.path.join(mapdl.directory, basename)
+                if os.path.abspath(filename) != os.path.abspath(destination):
+                    shutil.copyfile(filename, destination)
+            else:
+                mapdl.upload(filename, progress_bar=False)
+
+            cache[basename] = checksum
+
     class _mapdl_pool_ctx:
         """Provides the context manager for the ``MapdlPool`` class.
 
@@ -686,14 +783,15 @@ class MapdlPool:
             self._parent = weakref.ref(parent)
             self._instance = None
             self._return_index = return_index
+            self._task = None
 
         def __enter__(self):
-            if self._return_index:
-                mapdl, i = self._parent().next_available(return_index=True)
-                self._index = i
-
-            else:
-                mapdl = self._parent().next_available(return_index=False)
+            metrics = self._parent()._metrics
+            task = metrics.task_queued()
+            mapdl, i = self._parent().next_available(return_index=True)
+            self._index = i
+            metrics.task_started(task, i)
+            self._task = task
 
             self._instance = mapdl
             mapdl.locked = True
@@ -704,11 +802,15 @@ class MapdlPool:
             else:
                 return mapdl
 
-        def __exit__(self, *args):
+        def __exit__(self, exc_type, *args):
             mapdl = self._instance
             mapdl.locked = False
             mapdl._busy = False
 
+            parent = self._parent()
+            if parent is not None:
+                parent._metrics.task_finished(self._task, success=exc_type is None)
+
     def next(self, return_index: bool = False):
         """Return a context manager that returns available instances.
 
@@ -796,6 +898,10 @@ class MapdlPool:
         >>> pool.exit()
         """
         self._active = False  # kills any active instance restart
+        self._health_event.set()  # wake up the monitor so it can finish
+        self._release_ports()
+        if hasattr(self, "_metrics"):
+            self._metrics.stop_server()
 
         @threaded
         def threaded_exit(index, instance):
@@ -865,9 +971,15 @@ class MapdlPool:
         """Spawn a mapdl instance at an index"""
         # create a new temporary directory for each instance
         self._spawning_i += 1
+        self._shared_files_cache.pop(index, None)
 
         run_location = create_temp_dir(self._root_dir, name=name)
 
+        # Hand the reserved port over to MAPDL right before launching it
+        reservation = self._port_reservations.pop(port, None)
+        if reservation is not None:
+            reservation.release()
+
         self._instances[index] = launch_mapdl(
             exec_file=exec_file,
             run_location=run_location,
@@ -884,6 +996,12 @@ class MapdlPool:
             time.sleep(0.1)
 
         assert not self._instances[index].exited
+        self._watch_instance(self._instances[index])
+        if reservation is not None:
+            self._instances[index]._startup_timings[
+                "port_reservation"
+            ] = self._port_reservation_time
+        self._metrics.instance_spawned(index, self._instances[index].startup_timings)
         self._instances[index].prep7()
 
         # LOG.debug("Spawned instance %d. Name '%s'", index, name)
@@ -892,20 +1010,80 @@ class MapdlPool:
 
         self._spawning_i -= 1
 
+    def _release_ports(self) -> None:
+        """Release the ports reserved for instances which were not launched."""
+        while self._port_reservations:
+            _, reservation = self._port_reservations.popitem()
+            reservation.release()
+
+    def _watch_instance(self, instance) -> None:
+        """Register the pool monitor to be notified about the instance health.
+
+        The instance notifies the pool when its gRPC channel fails or when it
+        exits, so the pool monitor does not need to poll each instance.  The
+        per-instance heartbeat thread is also stopped since the pool monitor
+        takes care of keeping the remote instances alive.  The instance stops
+        tracking its channel when it exits.
+        """
+        health_event = self._health_event
+
+        def notify(mapdl):
+            health_event.set()
+
+        instance._health_callbacks.append(notify)
+        instance._subscribe_to_channel_state()
+        instance._stop_heartbeat()
+
+    @staticmethod
+    def _instance_has_died(instance) -> bool:
+        """Check if an instance which has not been exited is not reachable.
+
+        The process status is checked first since it does not involve any
+        request.  The server is only queried when the gRPC channel reports
+        an unhealthy state.
+        """
+        if instance._process_has_exited:
+            return True
+
+        if instance._channel_state in UNHEALTHY_CHANNEL_STATES and not instance.busy:
+            return not instance.is_alive
+
+        return False
+
     @threaded_daemon
     def _monitor_pool(self, refresh=1.0):
         """Checks if instances within a pool have exited (failed) and
         restarts them.
 
-
+        The monitor sleeps until an instance notifies a change in its
+        health (see ``_watch_instance``), hence failed instances are
+        restarted as soon as the failure is detected.  ``refresh`` is only
+        the maximum time between checks of the local processes status.
         """
+        last_keepalive = time.time()
+
         while self._active:
+            self._health_event.wait(refresh)
+            self._health_event.clear()
+
+            if not self._active:
+                break
+
             for index, instance in enumerate(self._instances):
                 name = self._names(index)
                 if not instance:  # encountered placeholder
                     continue
 
+                if not instance._exited and self._instance_has_died(instance):
+                    LOG.debug("Instance '%s' has died.", name)
+                    try:
+                        instance.exit(force=True)
+                    except Exception:
+                        pass
+                    instance._exited = True
+
                 if instance._exited:
+                    self._metrics.instance_respawned(index)
                     try:
                         self._spawning_i += 1
 
@@ -922,7 +1100,46 @@ class MapdlPool:
                         LOG.error(e, exc_info=True)
                         self._spawning_i -= 1
 
-            time.sleep(refresh)
+            if time.time() - last_keepalive > KEEPALIVE_DELAY:
+                self._keep_alive()
+                last_keepalive = time.time()
+
+    def _keep_alive(self) -> None:
+        """Send a request to the idle remote instances to keep them alive."""
+        for instance in self:
+            if instance._local or instance.locked or instance.busy:
+                continue
+            if not instance.is_alive:
+                # Next monitor iteration will respawn it.
+                instance._exited = True
+                self._health_event.set()
+
+    @property
+    def metrics(self) -> PoolMetrics:
+        """Usage metrics of the pool.
+
+        Number of tasks queued, running and completed, time waiting for an
+        available instance, task duration, busy and idle time per instance
+        and number of restarted instances.
+
+        Returns
+        -------
+        PoolMetrics
+            Metrics of the pool, which can be exported as a dictionary, JSON
+            or in Prometheus text format.
+
+        Examples
+        --------
+        >>> outputs = pool.run_batch(files)
+        >>> pool.metrics.to_dict()["task_duration"]["mean"]
+        4.254
+        >>> print(pool.metrics.to_prometheus())
+        # HELP pymapdl_pool_tasks Number of tasks queued or running.
+        # TYPE pymapdl_pool_tasks gauge
+        pymapdl_pool_tasks{state="queued"} 0
+        ...
+        """
+        return self._metrics
 
     @property
     def _ports(self):
@@ -1008,7 +1225,12 @@ class MapdlPool:
                 if port is None or isinstance(port, int):
                     port = port or MAPDL_DEFAULT_PORT
                     if self._start_instance:
-                        ports = available_ports(n_instances, port)
+                        tstart = time.time()
+                        self._port_reservations = {
+                            each.port: each for each in reserve_ports(n_instances, port)
+                        }
+                        self._port_reservation_time = time.time() - tstart
+                        ports = list(self._port_reservations)
                     else:
                         ports = [port + i for i in range(n_instances)]
 
@@ -0,0 +1,373 @@
+# Copyright (C) 2024 ANSYS, Inc. and/or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Telemetry for the MAPDL pool"""
+from http.server import BaseHTTPRequestHandler, HTTPServer
+import json
+import threading
+import time
+from typing import Any, Callable, Dict, List, Optional
+
+# Upper bounds (in seconds) of the histogram buckets
+DEFAULT_BUCKETS = (0.1, 0.5, 1.0, 5.0, 10.0, 30.0, 60.0, 300.0, 600.0, 1800.0)
+
+PROMETHEUS_PREFIX = "pymapdl_pool"
+
+
+class _Histogram:
+    """Cumulative histogram following the Prometheus conventions."""
+
+    def __init__(self, buckets=DEFAULT_BUCKETS):
+        self.buckets = tuple(sorted(buckets))
+        self.counts = [0 for _ in self.buckets]
+        self.count = 0
+        self.sum = 0.0
+        self.max = 0.0
+
+    def observe(self, value: float) -> None:
+        for i, bound in enumerate(self.buckets):
+            if value <= bound:
+                self.counts[i] += 1
+        self.count += 1
+        self.sum += value
+        self.max = max(self.max, value)
+
+    def to_dict(self) -> Dict[str, Any]:
+        buckets = {str(bound): count for bound, count in zip(self.buckets, self.counts)}
+        buckets["+Inf"] = self.count
+        return {
+            "buckets": buckets,
+            "count": self.count,
+            "sum": self.sum,
+            "max": self.max,
+            "mean": self.sum / self.count if self.count else 0.0,
+        }
+
+
+class _InstanceMetrics:
+    """Usage of one instance of the pool."""
+
+    def __init__(self, name: str):
+        self.name = name
+        self.created = time.time()
+        self.busy_time = 0.0
+        self.busy_since: Optional[float] = None
+        self.tasks = 0
+        self.respawns = 0
+        self.startup: Dict[str, float] = {}
+
+    def current_busy_time(self, now: float) -> float:
+        if self.busy_since is None:
+            return self.busy_time
+        return self.busy_time + now - self.busy_since
+
+    def to_dict(self, now: float) -> Dict[str, Any]:
+        busy_time = self.current_busy_time(now)
+        return {
+            "busy": self.busy_since is not None,
+            "busy_time": busy_time,
+            "idle_time": max(now - self.created - busy_time, 0.0),
+            "tasks": self.tasks,
+            "respawns": self.respawns,
+            "startup": dict(self.startup),
+        }
+
+
+class _Task:
+    """Timestamps of a task submitted to the pool."""
+
+    __slots__ = ("queued", "started", "index")
+
+    def __init__(self):
+        self.queued = time.time()
+        self.started: Optional[float] = None
+        self.index: Optional[int] = None
+
+
+class PoolMetrics:
+    """Collect the usage metrics of a :class:`MapdlPool <ansys.mapdl.core.MapdlPool>`.
+
+    The metrics are collected while the pool is running tasks through
+    :func:`MapdlPool.map() <ansys.mapdl.core.MapdlPool.map>`,
+    :func:`MapdlPool.run_batch() <ansys.mapdl.core.MapdlPool.run_batch>` or
+    :func:`MapdlPool.next() <ansys.mapdl.core.MapdlPool.next>`.
+    They can be exported as a dictionary, as JSON or as Prometheus text,
+    which can be served from a local HTTP endpoint.
+
+    Parameters
+    ----------
+    names : Callable, optional
+        Function returning the name of an instance given its index in the
+        pool.  By default, the instances are named ``"Instance_{i}"``.
+
+    buckets : tuple[float], optional
+        Upper bounds, in seconds, of the buckets used in the queue wait and
+        task duration histograms.
+
+    Examples
+    --------
+    >>> pool = MapdlPool(4)
+    >>> pool.run_batch(files)
+    >>> pool.metrics.to_dict()["tasks"]
+    {'queued': 0, 'running': 0, 'completed': 20, 'failed': 0}
+
+    Serve the metrics to be scraped by Prometheus.
+
+    >>> pool.metrics.serve(port=9100)
+    """
+
+    def __init__(
+        self,
+        names: Optional[Callable[[int], str]] = None,
+        buckets=DEFAULT_BUCKETS,
+    ):
+        self._names = names or (lambda i: f"Instance_{i}")
+        self._buckets = buckets
+        self._lock = threading.Lock()
+        self._server: Optional[HTTPServer] = None
+        self.reset()
+
+    def reset(self) -> None:
+        """Reset all the metrics."""
+        with self._lock:
+            self._queued = 0
+            self._running = 0
+            self._completed = 0
+            self._failed = 0
+            self._queue_wait = _Histogram(self._buckets)
+            self._task_duration = _Histogram(self._buckets)
+            self._instances: Dict[int, _InstanceMetrics] = {}
+
+    def _instance(self, index: int) -> _InstanceMetrics:
+        if index not in self._instances:
+            self._instances[index] = _InstanceMetrics(self._names(index))
+        return self._instances[index]
+
+    def instance_spawned(
+        self, index: int, startup_timings: Optional[Dict[str, float]] = None
+    ) -> None:
+        """Register an instance of the pool.
+
+        ``startup_timings`` is the time, in seconds, spent in each phase of
+        the instance launch. See :attr:`Mapdl.startup_timings
+        <ansys.mapdl.core.mapdl_grpc.MapdlGrpc.startup_timings>`.
+        """
+        with self._lock:
+            instance = self._instance(index)
+            if startup_timings:
+                instance.startup = dict(startup_timings)
+
+    def instance_respawned(self, index: int) -> None:
+        """Register that an instance has been restarted."""
+        with self._lock:
+            self._instance(index).respawns += 1
+
+    def task_queued(self) -> _Task:
+        """Register a task waiting for an available instance."""
+        with self._lock:
+            self._queued += 1
+        return _Task()
+
+    def task_started(self, task: _Task, index: int) -> None:
+        """Register that a task is running on the instance ``index``."""
+        now = time.time()
+        with self._lock:
+            task.started = now
+            task.index = index
+            self._queued -= 1
+            self._running += 1
+            self._queue_wait.observe(now - task.queued)
+
+            instance = self._instance(index)
+            instance.tasks += 1
+            instance.busy_since = now
+
+    def task_finished(self, task: _Task, success: bool = True) -> None:
+        """Register the end of a task."""
+        now = time.time()
+        with self._lock:
+            self._running -= 1
+            if success:
+                self._completed += 1
+            else:
+                self._failed += 1
+
+            self._task_duration.observe(now - task.started)
+
+            instance = self._instance(task.index)
+            if instance.busy_since is not None:
+                instance.busy_time += now - instance.busy_since
+                instance.busy_since = None
+
+    def to_dict(self) -> Dict[str, Any]:
+        """Return the metrics as a dictionary.
+
+        Returns
+        -------
+        dict
+            Dictionary with the following keys:
+
+            * ``"tasks"``: number of tasks queued, running, completed and failed.
+            * ``"queue_wait"``: histogram of the time (in seconds) tasks waited
+              for an available instance.
+            * ``"task_duration"``: histogram of the task duration in seconds.
+            * ``"instances"``: busy and idle time, number of tasks, number of
+              restarts and time spent in each startup phase for each instance.
+            * ``"respawns"``: total number of instances restarted.
+        """
+        now = time.time()
+        with self._lock:
+            instances = {
+                each.name: each.to_dict(now)
+                for _, each in sorted(self._instances.items())
+            }
+            return {
+                "tasks": {
+                    "queued": self._queued,
+                    "running": self._running,
+                    "completed": self._completed,
+                    "failed": self._failed,
+                },
+                "queue_wait": self._queue_wait.to_dict(),
+                "task_duration": self._task_duration.to_dict(),
+                "instances": instances,
+                "respawns": sum(each["respawns"] for each in instances.values()),
+            }
+
+    def to_json(self, **kwargs) -> str:
+        """Return the metrics as a JSON string.
+
+        Keyword arguments are passed to :func:`json.dumps`.
+        """
+        return json.dumps(self.to_dict(), **kwargs)
+
+    def to_prometheus(self) -> str:
+        """Return the metrics in the Prometheus text exposition format."""
+        metrics = self.to_dict()
+        prefix = PROMETHEUS_PREFIX
+        lines: List[str] = []
+
+        def header(name, type_, help_):
+            lines.append(f"# HELP {prefix}_{name} {help_}")
+            lines.append(f"# TYPE {prefix}_{name} {type_}")
+
+        header("tasks", "gauge", "Number of tasks queued or running.")
+        for state in ["queued", "running"]:
+            lines.append(f'{prefix}_tasks{{state="{state}"}} {metrics["tasks"][state]}')
+
+        header("tasks_total", "counter", "Number of tasks finished.")
+        for state in ["completed", "failed"]:
+            lines.append(
+                f'{prefix}_tasks_total{{state="{state}"}} {metrics["tasks"][state]}'
+            )
+
+        for name, help_ in [
+            ("queue_wait", "Time waiting for an available instance."),
+            ("task_duration", "Task duration."),
+        ]:
+            histogram = metrics[name]
+            header(f"{name}_seconds", "histogram", help_)
+            for bound, count in histogram["buckets"].items():
+                lines.append(f'{prefix}_{name}_seconds_bucket{{le="{bound}"}} {count}')
+            lines.append(f"{prefix}_{name}_seconds_sum {histogram['sum']}")
+            lines.append(f"{prefix}_{name}_seconds_count {histogram['count']}")
+
+        for key, name, help_ in [
+            ("busy_time", "instance_busy_seconds_total", "Time running tasks."),
+            ("idle_time", "instance_idle_seconds_total", "Time without tasks."),
+            ("tasks", "instance_tasks_total", "Number of tasks run."),
+            ("respawns", "instance_respawns_total", "Number of restarts."),
+        ]:
+            header(name, "counter", help_)
+            for instance, values in metrics["instances"].items():
+                lines.append(f'{prefix}_{name}{{instance="{instance}"}} {values[key]}')
+
+        header("instance_startup_seconds", "gauge", "Time spent in each startup phase.")
+        for instance, values in metrics["instances"].items():
+            for phase, value in values["startup"].items():
+                lines.append(
+                    f'{prefix}_instance_startup_seconds{{instance="{instance}",phase="{phase}"}} {value}'
+                )
+
+        return "\n".join(lines) + "\n"
+
+    def serve(self, port: int = 9100, host: str = "127.0.0.1") -> HTTPServer:
+        """Serve the metrics in the Prometheus format from a local HTTP endpoint.
+
+        The server runs in a daemon thread until :func:`PoolMetrics.stop_server`
+        is called.
+
+        Parameters
+        ----------
+        port : int, optional
+            Port to listen to. The default is ``9100``.  Use ``0`` to let the
+            operating system choose a free port.
+
+        host : str, optional
+            Address to listen to.  The default is ``"127.0.0.1"``.
+
+        Returns
+        -------
+        http.server.HTTPServer
+            Running server.  The actual port is available in
+            ``server.server_port``.
+        """
+        if self._server is not None:
+            raise RuntimeError("The metrics server is already running.")
+
+        metrics = self
+
+        class Handler(BaseHTTPRequestHandler):
+            def do_GET(self):
+                if self.path.rstrip("/") in ["", "/metrics"]:
+                    body = metrics.to_prometheus().encode()
+                    content_type = "text/plain; version=0.0.4"
+                elif self.path.rstrip("/") == "/json":
+                    body = metrics.to_json().encode()
+                    content_type = "application/json"
+                else:
+                    self.send_error(404)
+                    return
+
+                self.send_response(200)
+                self.send_header("Content-Type", content_type)
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.write(body)
+
+            def log_message(self, *args):
+                pass
+
+        self._server = HTTPServer((host, port), Handler)
+        thread = threading.Thread(
+            target=self._server.serve_forever, name="Pool_Metrics_Server"
+        )
+        thread.daemon = True
+        thread.start()
+        return self._server
+
+    def stop_server(self) -> None:
+        """Stop the HTTP server started with :func:`PoolMetrics.serve`."""
+        if self._server is not None:
+            self._server.shutdown()
+            self._server.server_close()
+            self._server = None
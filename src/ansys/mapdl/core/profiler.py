@@ -0,0 +1,301 @@
+# Copyright (C) 2024 ANSYS, Inc. and/or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Per-command profiling of a MAPDL session"""
+from functools import wraps
+import json
+import os
+import time
+from typing import Any, Dict, List, Optional, Union
+
+PHASES = ("client", "transit", "server", "parse")
+
+
+class _CommandRecord:
+    """Timings of one command sent through ``Mapdl.run``."""
+
+    __slots__ = ("name", "command", "start", "end", "spans", "children", "error")
+
+    def __init__(self, command: str, start: float):
+        self.command = command
+        self.name = command.split(",")[0].strip().upper()
+        self.start = start
+        self.end = start
+        self.spans: List[tuple] = []  # (kind, start, end)
+        self.children = 0.0  # time spent in nested commands
+        self.error = False
+
+    @property
+    def duration(self) -> float:
+        return self.end - self.start
+
+    def phases(self, latency: float) -> Dict[str, float]:
+        """Split the command duration in the profiling phases."""
+        rpc = 0.0
+        parse = 0.0
+        n_rpc = 0
+        for kind, start, end in self.spans:
+            if kind == "rpc":
+                rpc += end - start
+                n_rpc += 1
+            else:
+                parse += end - start
+
+        transit = min(rpc, n_rpc * latency)
+        return {
+            "client": max(self.duration - self.children - rpc - parse, 0.0),
+            "transit": transit,
+            "server": rpc - transit,
+            "parse": parse,
+        }
+
+
+class CommandProfiler:
+    """Timings of the commands run in a MAPDL session.
+
+    Created by :func:`Mapdl.profile() <ansys.mapdl.core.mapdl_grpc.MapdlGrpc.profile>`.
+    The duration of each command is split in these phases:
+
+    * ``"client"``: processing in PyMAPDL before and after the request,
+      for example the command checks in :func:`Mapdl.run()
+      <ansys.mapdl.core.Mapdl.run>`.
+    * ``"transit"``: time spent by the gRPC requests on the network.
+      It is estimated from the latency of an empty request measured when
+      the profiling starts.
+    * ``"server"``: rest of the gRPC requests time, that is the time MAPDL
+      spends running the command.
+    * ``"parse"``: processing of the response, for example the search for
+      errors in the command output.
+
+    Time spent in nested commands, for example the ``/SHOW`` command issued
+    before a plot, is only counted in the nested command.
+
+    Parameters
+    ----------
+    latency : float, optional
+        Round trip time, in seconds, of an empty gRPC request.
+
+    Examples
+    --------
+    >>> with mapdl.profile() as profiler:
+    ...     mapdl.prep7()
+    ...     mapdl.block(0, 1, 0, 1, 0, 1)
+    >>> print(profiler)
+    Command     Count   Total (s)   Client  Transit   Server    Parse
+    BLOCK           1      0.0041   0.0002   0.0007   0.0031   0.0001
+    /PREP7          1      0.0019   0.0001   0.0007   0.0010   0.0001
+
+    Export the timeline to be opened in ``chrome://tracing`` or Perfetto.
+
+    >>> profiler.to_chrome_trace("trace.json")
+    """
+
+    def __init__(self, latency: float = 0.0):
+        self.latency = latency
+        self._records: List[_CommandRecord] = []
+        self._stack: List[_CommandRecord] = []
+        # Timestamps relative to the profiler creation
+        self._t0 = time.perf_counter()
+        self._epoch = time.time()
+
+    def __repr__(self):
+        return f"CommandProfiler(commands={len(self._records)}, latency={self.latency})"
+
+    def __str__(self):
+        lines = [
+            f"{'Command':<10}{'Count':>7}{'Total (s)':>12}"
+            + "".join(f"{phase.capitalize():>9}" for phase in PHASES)
+        ]
+        for name, stats in self.summary().items():
+            lines.append(
+                f"{name:<10}{stats['count']:>7}{stats['total']:>12.4f}"
+                + "".join(f"{stats[phase]:>9.4f}" for phase in PHASES)
+            )
+        return "\n".join(lines)
+
+    def _begin(self, command: str) -> _CommandRecord:
+        record = _CommandRecord(command, time.perf_counter())
+        self._stack.append(record)
+        return record
+
+    def _end(self, record: _CommandRecord, error: bool = False) -> None:
+        record.end = time.perf_counter()
+        record.error = error
+        if self._stack and self._stack[-1] is record:
+            self._stack.pop()
+        if self._stack:
+            self._stack[-1].children += record.duration
+        self._records.append(record)
+
+    def _span(self, kind: str, start: float, end: float) -> None:
+        """Add a gRPC request (``"rpc"``) or a parsing (``"parse"``) span."""
+        if self._stack:
+            self._stack[-1].spans.append((kind, start, end))
+
+    @property
+    def records(self) -> List[Dict[str, Any]]:
+        """Timings of each command, in execution order.
+
+        The times are in seconds. ``"start"`` is relative to the start of
+        the profiling.
+        """
+        records = sorted(self._records, key=lambda record: record.start)
+        return [
+            {
+                "name": record.name,
+                "command": record.command,
+                "start": record.start - self._t0,
+                "duration": record.duration,
+                "error": record.error,
+                **record.phases(self.latency),
+            }
+            for record in records
+        ]
+
+    def summary(self) -> Dict[str, Dict[str, Any]]:
+        """Timings aggregated by command name.
+
+        Returns
+        -------
+        dict
+            Dictionary with the command names as keys, sorted by total time.
+            Each value contains the number of calls (``"count"``), the total,
+            mean and maximum duration (``"total"``, ``"mean"``, ``"max"``) and
+            the total time spent in each phase, in seconds.
+        """
+        summary: Dict[str, Dict[str, Any]] = {}
+        for record in self._records:
+            stats = summary.setdefault(
+                record.name,
+                {"count": 0, "total": 0.0, "max": 0.0, **dict.fromkeys(PHASES, 0.0)},
+            )
+            duration = record.duration - record.children
+            stats["count"] += 1
+            stats["total"] += duration
+            stats["max"] = max(stats["max"], duration)
+            for phase, value in record.phases(self.latency).items():
+                stats[phase] += value
+
+        for stats in summary.values():
+            stats["mean"] = stats["total"] / stats["count"]
+
+        return dict(
+            sorted(summary.items(), key=lambda item: item[1]["total"], reverse=True)
+        )
+
+    def to_dict(self) -> Dict[str, Any]:
+        """Return the latency, the summary and the records as a dictionary."""
+        return {
+            "latency": self.latency,
+            "summary": self.summary(),
+            "records": self.records,
+        }
+
+    def to_json(self, filename: Optional[Union[str, os.PathLike]] = None, **kwargs):
+        """Return the profiling data as a JSON string.
+
+        Parameters
+        ----------
+        filename : str, optional
+            If given, the JSON is written to this file instead.
+
+        **kwargs : dict
+            Keyword arguments passed to :func:`json.dumps`.
+        """
+        text = json.dumps(self.to_dict(), **kwargs)
+        if filename is None:
+            return text
+        with open(filename, "w") as fid:
+            fid.write(text)
+
+    def to_chrome_trace(self, filename: Optional[Union[str, os.PathLike]] = None):
+        """Return the commands timeline in the Chrome trace event format.
+
+        The file can be opened in ``chrome://tracing`` or in
+        `Perfetto <https://ui.perfetto.dev>`_. Each command is shown as a
+        slice containing its gRPC requests and response parsing.
+
+        Parameters
+        ----------
+        filename : str, optional
+            If given, the trace is written to this JSON file instead.
+
+        Returns
+        -------
+        dict
+            Trace, if ``filename`` is not given.
+        """
+
+        def event(name, start, end, args=None):
+            return {
+                "name": name,
+                "cat": "pymapdl",
+                "ph": "X",
+                "ts": (start - self._t0) * 1e6,
+                "dur": (end - start) * 1e6,
+                "pid": os.getpid(),
+                "tid": 0,
+                "args": args or {},
+            }
+
+        events = []
+        for record in self._records:
+            args = {"command": record.command, "error": record.error}
+            args.update(record.phases(self.latency))
+            events.append(event(record.name, record.start, record.end, args))
+            for kind, start, end in record.spans:
+                events.append(event(kind, start, end))
+
+        trace = {
+            "traceEvents": sorted(events, key=lambda each: each["ts"]),
+            "displayTimeUnit": "ms",
+            "otherData": {"latency": self.latency, "start": self._epoch},
+        }
+        if filename is None:
+            return trace
+        with open(filename, "w") as fid:
+            json.dump(trace, fid)
+
+
+def profile_command(func):
+    """Record the timings of a ``Mapdl.run`` call when profiling.
+
+    When the profiling is off, it only adds one attribute lookup.
+    """
+
+    @wraps(func)
+    def wrapper(self, *args, **kwargs):
+        profiler = self._profiler
+        if profiler is None:
+            return func(self, *args, **kwargs)
+
+        command = args[0] if args else kwargs.get("command", "")
+        record = profiler._begin(str(command))
+        error = True
+        try:
+            out = func(self, *args, **kwargs)
+            error = False
+            return out
+        finally:
+            profiler._end(record, error=error)
+
+    return wrapper
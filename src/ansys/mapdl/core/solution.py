@@ -20,10 +20,34 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
+from collections import deque
+import os
+import re
+import threading
+import time
+from typing import Any, Callable, Dict, List, Optional
 import weakref
 
 from ansys.mapdl.core.mapdl import MapdlBase
 
+# Maximum number of progress events kept by a ``SolveHandle``
+SOLVE_HISTORY_LENGTH = 10000
+
+_FLOAT = r"([-+]?\d*\.?\d+(?:[eE][-+]?\d+)?)"
+
+# Lines of the solution output reporting the progress
+_SOLVE_PATTERNS = {
+    "convergence": re.compile(
+        rf"(\w+)\s+CONVERGENCE VALUE\s*=\s*{_FLOAT}\s+CRITERION\s*=\s*{_FLOAT}(\s*<<< CONVERGED)?"
+    ),
+    "iteration": re.compile(r"EQUIL ITER\s+(\d+)\s+COMPLETED"),
+    "substep": re.compile(
+        r"LOAD STEP\s+(\d+)\s+SUBSTEP\s+(\d+)\s+COMPLETED\.\s+CUM ITER\s*=\s*(\d+)"
+    ),
+    "time": re.compile(rf"\*\*\* TIME\s*=\s*{_FLOAT}\s+TIME INC\s*=\s*{_FLOAT}"),
+    "not_converged": re.compile(r"SOLUTION NOT CONVERGED", re.IGNORECASE),
+}
+
 
 class Solution:
     """Collection of parameters specific to the solution.
@@ -390,3 +414,309 @@ class Solution:
         0.0
         """
         return self._mapdl.get_value("ACTIVE", 0, "SOLU", "CGITER")
+
+
+def parse_solve_line(line: str) -> Optional[Dict[str, Any]]:
+    """Parse a line of the solution output reporting the progress.
+
+    Parameters
+    ----------
+    line : str
+        Line of the ``SOLVE`` output.
+
+    Returns
+    -------
+    dict or None
+        Progress event, with the event type in ``"type"``, or ``None`` if
+        the line does not report any progress.
+
+    Examples
+    --------
+    >>> parse_solve_line(" FORCE CONVERGENCE VALUE  =  12.5  CRITERION=  0.35")
+    {'type': 'convergence', 'label': 'FORCE', 'value': 12.5, 'criterion': 0.35, 'converged': False}
+    """
+    for type_, pattern in _SOLVE_PATTERNS.items():
+        match = pattern.search(line)
+        if match is None:
+            continue
+
+        groups = match.groups()
+        if type_ == "convergence":
+            return {
+                "type": type_,
+                "label": groups[0].upper(),
+                "value": float(groups[1]),
+                "criterion": float(groups[2]),
+                "converged": groups[3] is not None,
+            }
+        elif type_ == "iteration":
+            return {"type": type_, "iteration": int(groups[0])}
+        elif type_ == "substep":
+            return {
+                "type": type_,
+                "load_step": int(groups[0]),
+                "substep": int(groups[1]),
+                "cum_iter": int(groups[2]),
+            }
+        elif type_ == "time":
+            return {
+                "type": type_,
+                "time": float(groups[0]),
+                "time_inc": float(groups[1]),
+            }
+        return {"type": type_}
+
+    return None
+
+
+class SolveHandle:
+    """Handle of a solution running in the background.
+
+    Returned by :func:`Mapdl.solve_async() <ansys.mapdl.core.mapdl_grpc.MapdlGrpc.solve_async>`.
+    The progress is parsed from the solution output while it is streamed,
+    so it does not need any extra request to MAPDL.
+
+    The other commands sent to the MAPDL instance raise an error until the
+    solution has finished.
+
+    Examples
+    --------
+    >>> handle = mapdl.solve_async()
+    >>> handle.progress
+    {'load_step': 1, 'substep': 3, 'cum_iter': 12, 'iteration': 2, 'time': 0.3,
+     'time_inc': 0.1, 'convergence': {'FORCE': {'value': 1.2e3, 'criterion': 5.0, 'converged': False}},
+     'not_converged': False}
+
+    Stop the solution if the force residual grows too much.
+
+    >>> def check(event):
+    ...     if event["type"] == "convergence" and event["value"] > 1e8:
+    ...         handle.cancel()
+    >>> handle.subscribe(check)
+    >>> output = handle.result()
+    """
+
+    def __init__(
+        self,
+        mapdl: MapdlBase,
+        command: str = "SOLVE",
+        abort_file: Optional[str] = None,
+        remote_abort_file: Optional[str] = None,
+        on_progress: Optional[Callable[[Dict[str, Any]], None]] = None,
+        stream_period: Optional[int] = None,
+    ):
+        self._mapdl_weakref = weakref.ref(mapdl)
+        self._command = command
+        self._abort_file = abort_file
+        self._remote_abort_file = remote_abort_file
+        self._stream_period = stream_period
+
+        self._lock = threading.Lock()
+        self._callbacks: List[Callable[[Dict[str, Any]], None]] = []
+        if on_progress is not None:
+            self._callbacks.append(on_progress)
+
+        self._partial_line = ""
+        self._history = deque(maxlen=SOLVE_HISTORY_LENGTH)
+        self._progress: Dict[str, Any] = {
+            "load_step": None,
+            "substep": None,
+            "cum_iter": None,
+            "iteration": None,
+            "time": None,
+            "time_inc": None,
+            "convergence": {},
+            "not_converged": False,
+        }
+        self._output: Optional[str] = None
+        self._exception: Optional[BaseException] = None
+        self._cancelled = False
+        self._done = threading.Event()
+
+        self._tstart = time.time()
+        self._tend: Optional[float] = None
+        self._thread = threading.Thread(
+            target=self._solve, name="MAPDL_Solve", daemon=True
+        )
+        self._thread.start()
+
+    def __repr__(self):
+        state = "cancelled" if self._cancelled else "done" if self.done else "running"
+        return f"<SolveHandle {self._command!r} {state}, elapsed={self.elapsed:.1f}s>"
+
+    @property
+    def _mapdl(self):
+        """Return the weakly referenced instance of mapdl"""
+        return self._mapdl_weakref()
+
+    def _solve(self):
+        kwargs = {"on_output": self._on_output}
+        if self._stream_period is not None:
+            kwargs["stream_period"] = self._stream_period
+
+        try:
+            self._output = self._mapdl.run(self._command, **kwargs)
+        except BaseException as exception:
+            self._exception = exception
+        finally:
+            self._on_output("\n")  # process the last line
+            self._tend = time.time()
+            if self._cancelled:
+                self._remove_abort_file()
+            self._done.set()
+
+    def _on_output(self, text: str):
+        lines = (self._partial_line + text).splitlines(keepends=True)
+        self._partial_line = ""
+        if lines and not lines[-1].endswith(("\n", "\r")):
+            self._partial_line = lines.pop()
+
+        for line in lines:
+            event = parse_solve_line(line)
+            if event is not None:
+                self._record(event)
+
+    def _record(self, event: Dict[str, Any]):
+        with self._lock:
+            self._history.append(event)
+            progress = self._progress
+            type_ = event["type"]
+            if type_ == "convergence":
+                progress["convergence"][event["label"]] = {
+                    "value": event["value"],
+                    "criterion": event["criterion"],
+                    "converged": event["converged"],
+                }
+            elif type_ == "not_converged":
+                progress["not_converged"] = True
+            else:
+                progress.update({k: v for k, v in event.items() if k != "type"})
+            callbacks = list(self._callbacks)
+
+        for callback in callbacks:
+            try:
+                callback(event)
+            except Exception as exception:  # pragma: no cover
+                mapdl = self._mapdl
+                if mapdl is not None:
+                    mapdl._log.error(f"Error in solve progress callback: {exception}")
+
+    def subscribe(self, callback: Callable[[Dict[str, Any]], None]) -> None:
+        """Call a function with each progress event.
+
+        The function is called from the thread reading the solution output,
+        hence it should return quickly.
+
+        Parameters
+        ----------
+        callback : callable
+            Function taking the event dictionary returned by
+            :func:`parse_solve_line`.
+        """
+        with self._lock:
+            self._callbacks.append(callback)
+
+    @property
+    def progress(self) -> Dict[str, Any]:
+        """Latest load step, substep, iteration, time and convergence norms.
+
+        ``"convergence"`` contains the last value and criterion of each
+        convergence norm, for example ``"FORCE"``.
+        """
+        with self._lock:
+            progress = dict(self._progress)
+            progress["convergence"] = {
+                key: dict(value) for key, value in progress["convergence"].items()
+            }
+            return progress
+
+    @property
+    def history(self) -> List[Dict[str, Any]]:
+        """Progress events received so far, oldest first.
+
+        Only the last ``SOLVE_HISTORY_LENGTH`` events are kept.
+        """
+        with self._lock:
+            return list(self._history)
+
+    @property
+    def done(self) -> bool:
+        """Whether the solution has finished, failed or been cancelled."""
+        return self._done.is_set()
+
+    @property
+    def cancelled(self) -> bool:
+        """Whether :func:`SolveHandle.cancel` has been called."""
+        return self._cancelled
+
+    @property
+    def elapsed(self) -> float:
+        """Time in seconds since the solution started."""
+        return (self._tend or time.time()) - self._tstart
+
+    def wait(self, timeout: Optional[float] = None) -> bool:
+        """Wait until the solution finishes.
+
+        Returns
+        -------
+        bool
+            ``True`` if the solution has finished, ``False`` if the timeout
+            expired before.
+        """
+        return self._done.wait(timeout)
+
+    def result(self, timeout: Optional[float] = None) -> str:
+        """Wait for the solution and return its output.
+
+        The errors raised while solving are raised here.
+
+        Parameters
+        ----------
+        timeout : float, optional
+            Maximum time to wait in seconds. By default, it waits until the
+            solution finishes.
+        """
+        if not self._done.wait(timeout):
+            raise TimeoutError(
+                f"The solution has not finished after {timeout} seconds."
+            )
+        if self._exception is not None:
+            raise self._exception
+        return self._output
+
+    def cancel(self) -> None:
+        """Request MAPDL to stop the solution.
+
+        An abort file (``Jobname.abt``) is written in the MAPDL working
+        directory. MAPDL stops at the end of the current equilibrium
+        iteration, so the results of the converged substeps are kept.
+        This works for nonlinear and transient analyses.
+
+        On remote sessions, the abort file is uploaded through a new gRPC
+        channel, since the channel of the MAPDL instance is streaming the
+        solution output in another thread.
+        """
+        if self.done or self._cancelled:
+            return
+
+        mapdl = self._mapdl
+        if mapdl is None:
+            return
+
+        self._cancelled = True
+        mapdl._log.info("Cancelling the solution.")
+        if self._abort_file is not None:
+            with open(self._abort_file, "w") as fid:
+                fid.write("nonlinear\n")
+        else:
+            mapdl._upload_raw_on_new_channel(b"nonlinear\n", self._remote_abort_file)
+
+    def _remove_abort_file(self):
+        try:
+            if self._abort_file is not None:
+                if os.path.exists(self._abort_file):
+                    os.remove(self._abort_file)
+            elif self._mapdl is not None:
+                self._mapdl.slashdelete(self._remote_abort_file)
+        except Exception:  # pragma: no cover
+            pass
@@ -0,0 +1,679 @@
+# Copyright (C) 2024 ANSYS, Inc. and/or its affiliates.
+# SPDX-License-Identifier: MIT
+#
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Keep MAPDL instances launched in the background and hand them over on request.
+
+Launching MAPDL takes from several seconds to more than a minute, most of it
+spent loading the executable and checking out the license.  A warm pool
+launches a number of instances beforehand and hands one over to
+:func:`launch_mapdl(prewarmed=True) <ansys.mapdl.core.launcher.launch_mapdl>`
+in milliseconds.  A new instance is launched in the background each time one
+is handed over, so the pool is always refilled.
+
+The warm pool is a daemon process started with ``pymapdl start --prewarm N``.
+It listens for JSON requests on a local TCP socket whose address is written
+to :data:`WARM_POOL_STATE_FILE`.  The state file also contains a random token
+which must be sent with each request, and only the user who started the warm
+pool can read it.
+
+An instance is only handed over when the launch options of the request, such
+as ``exec_file`` or ``nproc``, match the ones of the warm pool.
+"""
+
+import json
+import os
+import secrets
+import socket
+import socketserver
+import subprocess
+import sys
+import threading
+import time
+from typing import Any, Dict, List, Optional
+
+import grpc
+import psutil
+
+from ansys.mapdl import core as pymapdl
+from ansys.mapdl.core import LOG
+from ansys.mapdl.core.errors import MapdlRuntimeError
+from ansys.mapdl.core.launcher import (
+    LOCALHOST,
+    MAPDL_DEFAULT_PORT,
+    _verify_version,
+    launch_mapdl,
+    port_in_use,
+)
+from ansys.mapdl.core.misc import create_temp_dir, random_string, threaded_daemon
+
+# File where the running warm pool publishes its address and PID.
+WARM_POOL_STATE_FILE = os.path.join(pymapdl.USER_DATA_PATH, "warm_pool.json")
+
+# First port tried for the instances of the warm pool.  It is away from
+# ``MAPDL_DEFAULT_PORT`` so the warm instances do not take the port used by
+# a regular ``launch_mapdl`` call.
+WARM_POOL_STARTING_PORT = MAPDL_DEFAULT_PORT + 100
+
+# Seconds a client waits for the warm pool to answer a request.
+WARM_POOL_REQUEST_TIMEOUT = 5
+
+# Launch options which must match to hand over an instance, with their
+# ``launch_mapdl`` default.  ``None`` means any value is accepted.
+WARM_POOL_MATCHED_OPTIONS = {
+    "exec_file": None,
+    "version": None,
+    "nproc": None,
+    "ram": None,
+    "jobname": "file",
+    "run_location": None,
+    "additional_switches": "",
+}
+
+
+class WarmPool:
+    """Keep a number of MAPDL instances launched and ready to be used.
+
+    Parameters
+    ----------
+    size : int, optional
+        Number of instances kept ready.  Defaults to ``2``.
+
+    host : str, optional
+        Address where the pool listens for requests.  Defaults to
+        ``"127.0.0.1"``.  The instances are always launched locally.
+
+    port : int, optional
+        Port where the pool listens for requests.  Defaults to ``0``, which
+        uses any free port.  The address is written to the state file.
+
+    starting_port : int, optional
+        First port tried for the MAPDL instances.
+
+    state_file : str, optional
+        File where the address of the pool is written. Defaults to
+        :data:`WARM_POOL_STATE_FILE`.
+
+    **launch_kwargs : dict, optional
+        Arguments given to :func:`launch_mapdl()
+        <ansys.mapdl.core.launcher.launch_mapdl>` to launch each instance,
+        for example ``nproc`` or ``additional_switches``.  ``run_location``
+        is used as base directory for the directories of the instances.
+
+    Examples
+    --------
+    Keep four instances ready and serve requests until stopped.
+
+    >>> from ansys.mapdl.core.warm_pool import WarmPool
+    >>> pool = WarmPool(4, nproc=1)
+    >>> pool.serve_forever()
+
+    """
+
+    def __init__(
+        self,
+        size: int = 2,
+        host: str = LOCALHOST,
+        port: int = 0,
+        starting_port: int = WARM_POOL_STARTING_PORT,
+        state_file: Optional[str] = None,
+        **launch_kwargs,
+    ):
+        if size < 1:
+            raise ValueError("The warm pool must have at least one instance.")
+
+        for each_arg in ["port", "ip", "start_instance", "just_launch", "prewarmed"]:
+            if each_arg in launch_kwargs:
+                raise ValueError(
+                    f"The argument '{each_arg}' cannot be used to launch the instances of the warm pool."
+                )
+
+        self._size = size
+        self._host = host
+        self._port = port
+        self._starting_port = starting_port
+        self._state_file = state_file or WARM_POOL_STATE_FILE
+        self._base_dir = launch_kwargs.pop("run_location", None)
+        self._launch_kwargs = launch_kwargs
+
+        self._lock = threading.Lock()
+        self._ready: List[Dict[str, Any]] = []
+        self._launching = 0
+        self._handed_over = 0
+        self._failed = 0
+        self._reserved_ports: List[int] = []
+        self._stop_event = threading.Event()
+        self._server: Optional[socketserver.ThreadingTCPServer] = None
+        self._token = secrets.token_hex(16)
+
+    def __repr__(self):
+        status = self.status()
+        return (
+            f"MAPDL Warm Pool with {status['ready']} ready instances "
+            f"({status['launching']} launching)"
+        )
+
+    @property
+    def address(self) -> Optional[str]:
+        """Address (``"host:port"``) where the pool listens for requests."""
+        if self._server is None:
+            return None
+        host, port = self._server.server_address[:2]
+        return f"{host}:{port}"
+
+    def status(self) -> Dict[str, int]:
+        """Number of instances in each state.
+
+        Returns
+        -------
+        dict
+            Target ``size`` and the number of ``ready``, ``launching``,
+            ``handed_over`` and ``failed`` instances.
+        """
+        with self._lock:
+            return {
+                "size": self._size,
+                "ready": len(self._ready),
+                "launching": self._launching,
+                "handed_over": self._handed_over,
+                "failed": self._failed,
+            }
+
+    def start(self):
+        """Start listening for requests and launch the instances."""
+        self._stop_event.clear()
+        self._start_server()
+        self._refill()
+
+    def serve_forever(self):
+        """Start the pool and block until it is stopped."""
+        self.start()
+        try:
+            self._stop_event.wait()
+        except KeyboardInterrupt:  # pragma: no cover
+            pass
+        finally:
+            self.stop()
+
+    def mismatched_options(
+        self, launch_kwargs: Optional[Dict[str, Any]] = None
+    ) -> List[str]:
+        """Return the launch options which differ from the ones of the pool.
+
+        Parameters
+        ----------
+        launch_kwargs : dict, optional
+            Launch options requested, as given to :func:`launch_mapdl()
+            <ansys.mapdl.core.launcher.launch_mapdl>`.  Only the options in
+            :data:`WARM_POOL_MATCHED_OPTIONS` are compared.  Options left to
+            ``None`` accept any value.
+
+        Returns
+        -------
+        list[str]
+            Names of the options which differ.
+        """
+        launch_kwargs = launch_kwargs or {}
+        pool_kwargs = {**self._launch_kwargs, "run_location": self._base_dir}
+
+        mismatched = []
+        for name, default in WARM_POOL_MATCHED_OPTIONS.items():
+            requested = launch_kwargs.get(name, default)
+            if requested is None:
+                continue
+
+            available = pool_kwargs.get(name, default)
+            if name == "version":
+                requested = _verify_version(requested)
+                available = _verify_version(available)
+            elif name == "run_location" and available is not None:
+                requested = os.path.abspath(requested)
+                available = os.path.abspath(available)
+
+            if available is None or str(requested) != str(available):
+                mismatched.append(name)
+
+        return mismatched
+
+    def acquire(
+        self, launch_kwargs: Optional[Dict[str, Any]] = None
+    ) -> Optional[Dict[str, Any]]:
+        """Hand over a ready instance.
+
+        The instance is removed from the pool and a new one is launched in
+        the background.  The caller owns the handed over instance and is
+        responsible of exiting it.
+
+        Parameters
+        ----------
+        launch_kwargs : dict, optional
+            Launch options requested.  No instance is handed over when they
+            differ from the options of the pool.  See
+            :func:`WarmPool.mismatched_options`.
+
+        Returns
+        -------
+        dict or None
+            ``ip``, ``port``, ``pid`` and ``directory`` of the instance, or
+            ``None`` if there is no ready instance or the launch options
+            differ.
+        """
+        mismatched = self.mismatched_options(launch_kwargs)
+        if mismatched:
+            LOG.debug(
+                "Not handing over a warm instance because these launch options differ: %s",
+                ", ".join(mismatched),
+            )
+            return None
+
+        instance = None
+        with self._lock:
+            while self._ready:
+                candidate = self._ready.pop(0)
+                if psutil.pid_exists(candidate["pid"]):
+                    instance = candidate
+                    self._handed_over += 1
+                    break
+                LOG.debug(
+                    "Warm instance at port %s died before being used.",
+                    candidate["port"],
+                )
+                self._failed += 1
+
+        self._refill()
+        return instance
+
+    def stop(self):
+        """Stop serving requests and exit the instances not handed over.
+
+        The handed over instances are child processes of the warm pool.
+        Exit them before stopping the warm pool.
+        """
+        self._stop_event.set()
+
+        if self._server is not None:
+            self._server.shutdown()
+            self._server.server_close()
+            self._server = None
+
+        if os.path.isfile(self._state_file):
+            try:
+                with open(self._state_file) as fid:
+                    state = json.load(fid)
+                if state.get("pid") == os.getpid():
+                    os.remove(self._state_file)
+            except (OSError, ValueError):  # pragma: no cover
+                pass
+
+        with self._lock:
+            instances, self._ready = self._ready, []
+
+        for instance in instances:
+            _kill_process_tree(instance["pid"])
+
+    def _refill(self):
+        """Launch instances until the pool reaches its size."""
+        with self._lock:
+            if self._stop_event.is_set():
+                return
+            missing = self._size - len(self._ready) - self._launching
+            self._launching += max(missing, 0)
+
+        for _ in range(missing):
+            self._launch_instance(thread_name="WarmPool_launch")
+
+    @threaded_daemon
+    def _launch_instance(self):
+        """Launch an instance and add it to the ready instances."""
+        reserved_port = self._reserve_port()
+        instance = None
+        try:
+            directory = create_temp_dir(
+                self._base_dir, name=f"ansys_{random_string(10)}"
+            )
+            ip, port, pid = launch_mapdl(
+                run_location=directory,
+                port=reserved_port,
+                start_instance=True,
+                just_launch=True,
+                **self._launch_kwargs,
+            )
+            _wait_until_ready(ip, port, self._launch_kwargs.get("start_timeout", 45))
+            instance = {"ip": ip, "port": port, "pid": pid, "directory": directory}
+            LOG.debug("Warm instance ready at %s:%s (PID=%s).", ip, port, pid)
+
+        except Exception as error:
+            LOG.error("Failed to launch a warm instance: %s", str(error))
+
+        finally:
+            with self._lock:
+                self._launching -= 1
+                self._reserved_ports.remove(reserved_port)
+                if instance is None:
+                    self._failed += 1
+                elif self._stop_event.is_set():
+                    _kill_process_tree(instance["pid"])
+                else:
+                    self._ready.append(instance)
+
+        if instance is None and not self._stop_event.is_set():
+            # Avoid a tight relaunching loop when the launch keeps failing,
+            # for example because there are no licenses available.
+            self._stop_event.wait(5)
+            self._refill()
+
+    def _reserve_port(self) -> int:
+        """Return a free port not used by any instance being launched."""
+        with self._lock:
+            used = set(self._reserved_ports) | {each["port"] for each in self._ready}
+            port = self._starting_port
+            while port in used or port in pymapdl._LOCAL_PORTS or port_in_use(port):
+                port += 1
+            self._reserved_ports.append(port)
+        return port
+
+    def _start_server(self):
+        """Open the socket and start answering requests in the background."""
+        pool = self
+
+        class _Handler(socketserver.StreamRequestHandler):
+            def handle(self):
+                try:
+                    request = json.loads(self.rfile.readline().decode())
+                    response = pool._answer(request)
+                except Exception as error:
+                    response = {"error": str(error)}
+                self.wfile.write((json.dumps(response) + "\n").encode())
+
+        self._server = socketserver.ThreadingTCPServer(
+            (self._host, self._port), _Handler
+        )
+        self._server.daemon_threads = True
+        threading.Thread(
+            target=self._server.serve_forever, name="WarmPool_server", daemon=True
+        ).start()
+
+        host, port = self._server.server_address[:2]
+        state = {"host": host, "port": port, "pid": os.getpid(), "token": self._token}
+
+        # Only readable by the user who started the pool, since the token
+        # grants access to the instances.
+        if os.path.isfile(self._state_file):
+            os.remove(self._state_file)
+        descriptor = os.open(
+            self._state_file, os.O_WRONLY | os.O_CREAT | os.O_EXCL, 0o600
+        )
+        with os.fdopen(descriptor, "w") as fid:
+            json.dump(state, fid)
+
+        LOG.debug("Warm pool listening at %s:%s", host, port)
+
+    def _answer(self, request: Dict[str, Any]) -> Dict[str, Any]:
+        """Answer a request received through the socket."""
+        if not secrets.compare_digest(str(request.get("token", "")), self._token):
+            raise PermissionError("Invalid warm pool token.")
+
+        action = request.get("action")
+        if action == "acquire":
+            launch_kwargs = request.get("launch_kwargs")
+            return {
+                "instance": self.acquire(launch_kwargs),
+                "mismatched_options": self.mismatched_options(launch_kwargs),
+            }
+        elif action == "status":
+            return self.status()
+        elif action == "stop":
+            # Stopping from the handler thread would wait for itself.
+            threading.Thread(target=self.stop, daemon=True).start()
+            return {"stopped": True}
+        raise ValueError(f"Unknown action '{action}'.")
+
+
+def _wait_until_ready(ip: str, port: int, timeout: float):
+    """Wait until the gRPC server of the instance accepts connections."""
+    channel = grpc.insecure_channel(f"{ip}:{port}")
+    try:
+        grpc.channel_ready_future(channel).result(timeout=timeout)
+    except grpc.FutureTimeoutError:
+        raise MapdlRuntimeError(
+            f"The MAPDL instance at {ip}:{port} was not ready after {timeout} seconds."
+        )
+    finally:
+        channel.close()
+
+
+def _kill_process_tree(pid: int):
+    """Kill a process and all its children."""
+    try:
+        parent = psutil.Process(pid)
+        processes = parent.children(recursive=True) + [parent]
+    except psutil.NoSuchProcess:
+        return
+
+    for process in processes:
+        try:
+            process.kill()
+        except psutil.NoSuchProcess:
+            pass
+
+
+def get_warm_pool_address(state_file: Optional[str] = None) -> Optional[str]:
+    """Return the address of the running warm pool.
+
+    Parameters
+    ----------
+    state_file : str, optional
+        File where the warm pool writes its address. Defaults to
+        :data:`WARM_POOL_STATE_FILE`.
+
+    Returns
+    -------
+    str or None
+        Address as ``"host:port"``, or ``None`` if no warm pool is running.
+    """
+    state = _read_state(state_file)
+    if state is None:
+        return None
+    return f"{state['host']}:{state['port']}"
+
+
+def _read_state(state_file: Optional[str] = None) -> Optional[Dict[str, Any]]:
+    """Return the state written by the running warm pool, if any."""
+    state_file = state_file or WARM_POOL_STATE_FILE
+    if not os.path.isfile(state_file):
+        return None
+
+    try:
+        with open(state_file) as fid:
+            state = json.load(fid)
+    except (OSError, ValueError):
+        return None
+
+    if not psutil.pid_exists(state["pid"]):
+        LOG.debug("Removing stale warm pool state file %s", state_file)
+        try:
+            os.remove(state_file)
+        except OSError:  # pragma: no cover
+            pass
+        return None
+
+    return state
+
+
+def request_warm_pool(
+    action: str,
+    address: Optional[str] = None,
+    timeout: float = WARM_POOL_REQUEST_TIMEOUT,
+    state_file: Optional[str] = None,
+    **data,
+) -> Optional[Dict[str, Any]]:
+    """Send a request to the running warm pool.
+
+    Parameters
+    ----------
+    action : str
+        One of ``"acquire"``, ``"status"`` or ``"stop"``.
+
+    address : str, optional
+        Address of the warm pool as ``"host:port"``.  Defaults to the
+        address written in the state file.
+
+    timeout : float, optional
+        Seconds to wait for the answer.
+
+    state_file : str, optional
+        File where the warm pool writes its address and token. Defaults to
+        :data:`WARM_POOL_STATE_FILE`.
+
+    **data : dict, optional
+        Additional fields of the request, for example ``launch_kwargs``.
+
+    Returns
+    -------
+    dict or None
+        Answer of the warm pool, or ``None`` if no warm pool is reachable.
+    """
+    state = _read_state(state_file)
+    if address is None and state is not None:
+        address = f"{state['host']}:{state['port']}"
+    if address is None:
+        return None
+
+    request = {"action": action, "token": state["token"] if state else "", **data}
+    host, port = address.rsplit(":", 1)
+    try:
+        with socket.create_connection((host, int(port)), timeout=timeout) as sock:
+            sock.sendall((json.dumps(request) + "\n").encode())
+            with sock.makefile("rb") as fid:
+                response = json.loads(fid.readline().decode())
+    except (OSError, ValueError) as error:
+        LOG.debug("Could not reach the warm pool at %s: %s", address, str(error))
+        return None
+
+    if "error" in response:
+        raise MapdlRuntimeError(f"The warm pool failed to answer: {response['error']}")
+
+    return response
+
+
+def acquire_warm_instance(
+    address: Optional[str] = None,
+    launch_kwargs: Optional[Dict[str, Any]] = None,
+    state_file: Optional[str] = None,
+) -> Optional[Dict[str, Any]]:
+    """Get a ready MAPDL instance from the running warm pool.
+
+    Parameters
+    ----------
+    address : str, optional
+        Address of the warm pool as ``"host:port"``.  Defaults to the
+        address written in the state file.
+
+    launch_kwargs : dict, optional
+        Launch options requested.  No instance is handed over when they
+        differ from the options of the warm pool.  See
+        :data:`WARM_POOL_MATCHED_OPTIONS`.
+
+    state_file : str, optional
+        File where the warm pool writes its address and token. Defaults to
+        :data:`WARM_POOL_STATE_FILE`.
+
+    Returns
+    -------
+    dict or None
+        ``ip``, ``port``, ``pid`` and ``directory`` of the instance, or
+        ``None`` if no warm pool is running, it has no ready instances or
+        its launch options differ.
+    """
+    response = request_warm_pool(
+        "acquire", address=address, state_file=state_file, launch_kwargs=launch_kwargs
+    )
+    if response is None:
+        return None
+
+    if response.get("mismatched_options"):
+        LOG.info(
+            "The warm pool instances were launched with different options: %s",
+            ", ".join(response["mismatched_options"]),
+        )
+    return response["instance"]
+
+
+def start_warm_pool_daemon(
+    size: int, timeout: float = 10, **launch_kwargs
+) -> subprocess.Popen:
+    """Start a warm pool in a detached process.
+
+    Parameters
+    ----------
+    size : int
+        Number of instances kept ready.
+
+    timeout : float, optional
+        Seconds to wait for the warm pool to publish its address.
+
+    **launch_kwargs : dict, optional
+        Arguments given to :class:`WarmPool`.  They must be serializable
+        to JSON.
+
+    Returns
+    -------
+    subprocess.Popen
+        Process running the warm pool.
+    """
+    if get_warm_pool_address() is not None:
+        raise MapdlRuntimeError("There is a warm pool already running.")
+
+    config = json.dumps({"size": size, **launch_kwargs})
+    kwargs = {}
+    if os.name == "nt":  # pragma: no cover
+        kwargs["creationflags"] = subprocess.CREATE_NEW_PROCESS_GROUP
+    else:
+        kwargs["start_new_session"] = True
+
+    process = subprocess.Popen(
+        [sys.executable, "-m", "ansys.mapdl.core.warm_pool", config],
+        stdin=subprocess.DEVNULL,
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.DEVNULL,
+        **kwargs,
+    )
+
+    t_end = time.time() + timeout
+    while get_warm_pool_address() is None:
+        if process.poll() is not None:
+            raise MapdlRuntimeError(
+                f"The warm pool process exited with code {process.returncode}."
+            )
+        if time.time() > t_end:
+            process.kill()
+            raise MapdlRuntimeError(
+                f"The warm pool did not start after {timeout} seconds."
+            )
+        time.sleep(0.1)
+
+    return process
+
+
+if __name__ == "__main__":  # pragma: no cover
+    # The instances of the warm pool are always launched locally.
+    os.environ.pop("PYMAPDL_START_INSTANCE", None)
+    WarmPool(**json.loads(sys.argv[1])).serve_forever()
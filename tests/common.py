@@ -23,6 +23,9 @@
 """Shared testing module"""
 from collections import namedtuple
 import os
+import socket
+import threading
+import time
 from typing import Dict
 
 from ansys.mapdl.core.launcher import _is_ubuntu
@@ -186,3 +189,67 @@ def get_details_of_elements(mapdl_) -> Dict[int, Node]:
             if len(args) == 6:
                 elements[args[0]] = Element(*args, node_numbers=None)
     return elements
+
+
+class ThrottledProxy:
+    """TCP proxy limiting the bandwidth and adding latency to a connection.
+
+    Used to benchmark the gRPC transfers as if MAPDL were running on a
+    remote cluster.
+
+    Parameters
+    ----------
+    ip : str
+        IP address of the proxied server.
+    port : int
+        Port of the proxied server.
+    bandwidth : float
+        Bandwidth in bytes per second for each direction.
+    latency : float, optional
+        Delay in seconds added to each forwarded packet.
+    """
+
+    def __init__(self, ip, port, bandwidth, latency=0.0):
+        self.address = (ip, port)
+        self.bandwidth = bandwidth
+        self.latency = latency
+
+        self._server = socket.create_server(("127.0.0.1", 0))
+        self.port = self._server.getsockname()[1]
+        self._closed = threading.Event()
+        self._sockets = []
+
+    def __enter__(self):
+        threading.Thread(target=self._accept, daemon=True).start()
+        return self
+
+    def __exit__(self, *args):
+        self._closed.set()
+        for each in [self._server] + self._sockets:
+            each.close()
+
+    def _accept(self):
+        while not self._closed.is_set():
+            try:
+                client, _ = self._server.accept()
+            except OSError:
+                return
+            server = socket.create_connection(self.address)
+            self._sockets.extend([client, server])
+            for source, target in [(client, server), (server, client)]:
+                threading.Thread(
+                    target=self._forward, args=(source, target), daemon=True
+                ).start()
+
+    def _forward(self, source, target):
+        try:
+            while True:
+                data = source.recv(16 * 1024)
+                if not data:
+                    break
+                time.sleep(self.latency + len(data) / self.bandwidth)
+                target.sendall(data)
+        except OSError:
+            pass
+        finally:
+            target.close()
@@ -311,6 +311,12 @@ def pytest_addoption(parser):
         help="run console tests",
     )
     parser.addoption("--gui", action="store_true", default=False, help="run GUI tests")
+    parser.addoption(
+        "--benchmark",
+        action="store_true",
+        default=False,
+        help="run benchmark tests",
+    )
     parser.addoption(
         "--only-gui",
         action="store_true",
@@ -327,6 +333,12 @@ def pytest_collection_modifyitems(config, items):
             if "console" in item.keywords:
                 item.add_marker(skip_console)
 
+    if not config.getoption("--benchmark"):
+        skip_benchmark = pytest.mark.skip(reason="need --benchmark option to run")
+        for item in items:
+            if "benchmark" in item.keywords:
+                item.add_marker(skip_benchmark)
+
     if not HAS_GRPC:
         skip_grpc = pytest.mark.skip(
             reason="Requires gRPC connection (at least v211 to run)"
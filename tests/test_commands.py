@@ -29,6 +29,7 @@ from ansys.mapdl.core import examples
 from ansys.mapdl.core.commands import (
     CMD_BC_LISTING,
     CMD_LISTING,
+    BinaryListingOutput,
     BoundaryConditionsListingOutput,
     CommandListingOutput,
     CommandOutput,
@@ -593,6 +594,43 @@ def test_cmd_class_prnsol_short():
         assert isinstance(out_df, pd.DataFrame) and not out_df.empty
 
 
+@pytest.mark.parametrize(
+    "output", [PRNSOL_OUT, PRNSOL_OUT_LONG, set_list_0, set_list_1]
+)
+def test_parse_table_vectorized(output):
+    out = CommandListingOutput(output)
+    expected = out._parse_table_lines()
+    parsed = out._parse_table()
+    assert parsed.shape == expected.shape
+    assert np.array_equal(parsed, expected)
+
+
+def test_parse_table_vectorized_large():
+    header = """
+ LIST ALL SELECTED NODES.   DSYS=      0
+
+    NODE        X                   Y                   Z"""
+    lines = []
+    for i in range(1, 20001):
+        if i % 20 == 1:
+            lines.append(header)
+        lines.append(f"{i:8d} {i * 0.1:19.12E}{-i * 0.2:19.12E}{i * 1e-3:19.12f}")
+
+    out = CommandListingOutput("\n".join(lines))
+    parsed = out._parse_table()
+    assert parsed.shape == (20000, 4)
+    assert np.array_equal(parsed, out._parse_table_lines())
+
+
+def test_parse_table_vectorized_fallback():
+    # Rows with different number of values
+    out = CommandListingOutput("1 2 3\n4 5 (6)\n7 8 9")
+    assert np.array_equal(out._parse_table(), out._parse_table_lines())
+
+    assert CommandListingOutput("")._parse_table().size == 0
+    assert CommandListingOutput("NO DATA")._parse_table().size == 0
+
+
 def test_cmd_class_dlist_vm(mapdl, cleared):
     # Run only the first 100 lines of VM223
     with open(verif_files.vmfiles["vm223"]) as fid:
@@ -735,6 +773,92 @@ def test_nlist_to_array(mapdl, beam_solve):
     assert np.allclose(nlist.to_array()[:, 1:4], mapdl.mesh.nodes)
 
 
+def test_binary_listing_output():
+    data = np.array([[1, 0.1, 0.2], [2, 0.3, 0.4]])
+    obj = BinaryListingOutput(data, "NLIST", ["NODE", "X", "Y"])
+
+    assert isinstance(obj, CommandListingOutput)
+    assert "NLIST" in obj
+    assert obj.to_array() is data
+    assert obj.to_list() == data.tolist()
+    assert obj.get_columns() == ["NODE", "X", "Y"]
+
+    if has_dependency("pandas"):
+        df = obj.to_dataframe()
+        assert list(df.columns) == ["NODE", "X", "Y"]
+        assert np.allclose(df.values, data)
+
+
+def test_nlist_binary(mapdl, beam_solve):
+    nlist = mapdl.nlist()
+    nlist_binary = mapdl.nlist(binary=True)
+
+    assert isinstance(nlist_binary, BinaryListingOutput)
+    assert nlist_binary.get_columns() == nlist.get_columns()
+    assert np.allclose(nlist_binary.to_array(), nlist.to_array(), atol=1e-4)
+
+    nlist = mapdl.nlist(2, 8, 2)
+    nlist_binary = mapdl.nlist(2, 8, 2, binary=True)
+    assert np.allclose(nlist_binary.to_array(), nlist.to_array(), atol=1e-4)
+
+    # Not supported, hence listed as text
+    nlist_binary = mapdl.nlist(kinternal="internal", binary=True)
+    assert not isinstance(nlist_binary, BinaryListingOutput)
+    assert isinstance(nlist_binary, CommandListingOutput)
+
+
+@pytest.mark.parametrize("comp", ["", "COMP", "X", "SUM"])
+def test_prnsol_binary(mapdl, beam_solve, comp):
+    prnsol = mapdl.prnsol("U", comp)
+    prnsol_binary = mapdl.prnsol("U", comp, binary=True)
+
+    assert isinstance(prnsol_binary, BinaryListingOutput)
+    assert prnsol_binary.get_columns() == prnsol.get_columns()
+    assert np.allclose(
+        prnsol_binary.to_array(), prnsol.to_array(), rtol=1e-4, atol=1e-10
+    )
+
+
+def test_prnsol_binary_stress(mapdl, cleared):
+    mapdl.prep7()
+    mapdl.et(1, "SOLID185")
+    mapdl.mp("EX", 1, 2e11)
+    mapdl.mp("PRXY", 1, 0.3)
+    mapdl.block(0, 2, 0, 1, 0, 1)
+    mapdl.esize(0.5)
+    mapdl.vmesh("ALL")
+    mapdl.nsel("S", "LOC", "X", 0)
+    mapdl.d("ALL", "ALL")
+    mapdl.nsel("S", "LOC", "X", 2)
+    mapdl.f("ALL", "FX", 1000)
+    mapdl.allsel()
+    mapdl.slashsolu()
+    mapdl.solve()
+    mapdl.finish()
+
+    mapdl.post1()
+    mapdl.set(1, 1)
+    n_nodes = mapdl.mesh.n_node
+
+    # All the nodes are selected, but only the ones attached to the
+    # selected elements have stresses listed
+    mapdl.esel("S", "CENT", "X", 0, 1)
+    prnsol = mapdl.prnsol("S", "COMP")
+    prnsol_binary = mapdl.prnsol("S", "COMP", binary=True)
+
+    assert isinstance(prnsol_binary, BinaryListingOutput)
+    assert prnsol_binary.get_columns() == prnsol.get_columns()
+    assert prnsol_binary.to_array().shape == prnsol.to_array().shape
+    assert prnsol_binary.to_array().shape[0] < n_nodes
+    assert np.allclose(
+        prnsol_binary.to_array(), prnsol.to_array(), rtol=1e-4, atol=1e-3
+    )
+
+    # The node selection is restored
+    assert mapdl.get_value("NODE", 0, "COUNT") == n_nodes
+    mapdl.allsel()
+
+
 def test_cmlist(mapdl):
     mapdl.clear()
 
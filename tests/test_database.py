@@ -21,6 +21,7 @@
 # SOFTWARE.
 
 import re
+import time
 
 from ansys.tools.versioning import server_meets_version
 import numpy as np
@@ -216,6 +217,13 @@ def test_nodes_asarray(nodes):
     assert np.allclose(angles, 0)
 
 
+def test_nodes_asarray_no_angles(nodes):
+    ind, coords, angles = nodes.all_asarray(angles=False)
+    assert angles is None
+    assert np.allclose(ind, np.arange(1, 426))
+    assert np.allclose(coords, nodes._db._mapdl.mesh.nodes)
+
+
 def test_nodes_push(nodes):
     nnum = 100000
     x, y, z, xang, yang, zang = 1, 5, 10, 30, 40, 50
@@ -232,6 +240,42 @@ def test_nodes_push(nodes):
         nodes.push(nnum, x, y, z, zang=1)
 
 
+def test_nodes_push_many(nodes):
+    inod = np.arange(200001, 200101)
+    xyz = np.random.random((inod.size, 3))
+    angles = np.random.random((inod.size, 3)) * 90
+
+    assert nodes.push_many(inod, xyz, angles, batch_size=16) == inod.size
+    for i in [0, 50, 99]:
+        selected, coord = nodes.coord(int(inod[i]))
+        assert np.allclose(coord, np.hstack((xyz[i], angles[i])))
+
+    with pytest.raises(ValueError, match="must have shape"):
+        nodes.push_many(inod, xyz[:, :2])
+
+    with pytest.raises(ValueError, match="must have shape"):
+        nodes.push_many(inod, xyz, angles[:-1])
+
+
+@pytest.mark.benchmark
+def test_nodes_push_many_benchmark(nodes, record_property):
+    inod = np.arange(300001, 300501)
+    xyz = np.random.random((inod.size, 3))
+
+    tstart = time.perf_counter()
+    for node, (x, y, z) in zip(inod.tolist(), xyz.tolist()):
+        nodes.push(node, x, y, z)
+    time_push = time.perf_counter() - tstart
+
+    tstart = time.perf_counter()
+    nodes.push_many(inod, xyz)
+    time_push_many = time.perf_counter() - tstart
+
+    record_property("time_push", time_push)
+    record_property("time_push_many", time_push_many)
+    assert time_push_many < time_push
+
+
 def test_elems_repr(elems):
     assert "64" in str(elems)
     assert "Number of elements" in str(elems)
@@ -276,6 +320,30 @@ def test_elems_get(elems):
     assert elem_info.ielem == ielm
 
 
+def test_elems_asarray(elems):
+    enum, elmdat, offsets, nodes = elems.all_asarray()
+    assert np.allclose(enum, np.arange(1, 65))
+    assert elmdat.shape == (64, 10)
+    assert offsets.size == 65
+    assert offsets[-1] == nodes.size
+
+    for ielm in [1, 32, 64]:
+        elem_info = elems.get(ielm)
+        i = ielm - 1
+        assert list(nodes[offsets[i] : offsets[i + 1]]) == list(elem_info.nodes)
+        assert elmdat[i, 8] == ielm
+        assert list(elmdat[i, :3]) == list(elem_info.elmdat[:3])
+
+    # only the selected elements are returned
+    mapdl = elems._db._mapdl
+    mapdl.esel("S", "ELEM", "", 1, 10)
+    enum, elmdat, offsets, nodes = elems.all_asarray()
+    mapdl.allsel()
+    assert np.allclose(enum, np.arange(1, 11))
+    assert elmdat.shape == (10, 10)
+    assert offsets.size == 11
+
+
 def test_elems_push(elems):
     ielm = 1
     elem_info = elems.get(ielm)
@@ -292,6 +360,26 @@ def test_elems_push(elems):
         elems.push(ielm_new, [1, 2, 3], elem_info.nodes)
 
 
+def test_elems_push_many(elems):
+    mapdl = elems._db._mapdl
+    mapdl.esel("S", "ELEM", "", 1, 64)
+    enum, elmdat, offsets, nodes = elems.all_asarray()
+    mapdl.allsel()
+
+    ielm = enum + 20000
+    assert elems.push_many(ielm, elmdat, offsets, nodes, batch_size=8) == 64
+    for i in [0, 31, 63]:
+        elem_info = elems.get(int(ielm[i]))
+        assert list(elem_info.nodes) == list(nodes[offsets[i] : offsets[i + 1]])
+        assert list(elem_info.elmdat[:8]) == list(elmdat[i, :8])
+
+    with pytest.raises(ValueError, match="``elmdat`` must have shape"):
+        elems.push_many(ielm, elmdat[:, :5], offsets, nodes)
+
+    with pytest.raises(ValueError, match="``offsets`` does not match"):
+        elems.push_many(ielm, elmdat, offsets[:-1], nodes)
+
+
 def test__channel_str(db):
     assert db._channel_str is not None
     assert ":" in db._channel_str
@@ -25,20 +25,29 @@ import os
 import re
 import shutil
 import sys
+import time
 
+from ansys.api.mapdl.v0.mapdl_pb2_grpc import MapdlServiceStub
 import pytest
 
-from ansys.mapdl.core import examples
-from ansys.mapdl.core.common_grpc import DEFAULT_CHUNKSIZE
+from ansys.mapdl.core import examples, mapdl_grpc
+from ansys.mapdl.core.common_grpc import (
+    DEFAULT_CHUNKSIZE,
+    MAX_CHUNKSIZE,
+    MIN_CHUNKSIZE,
+    AdaptiveChunkSize,
+)
 from ansys.mapdl.core.errors import (
     MapdlCommandIgnoredError,
     MapdlExitedError,
     MapdlRuntimeError,
 )
-from ansys.mapdl.core.misc import random_string
+from ansys.mapdl.core.mapdl_grpc import UPLOAD_RECORD_SUFFIX
+from ansys.mapdl.core.misc import file_checksum, random_string
 
 PATH = os.path.dirname(os.path.abspath(__file__))
 
+from common import ThrottledProxy
 from conftest import has_dependency, requires
 
 # skip entire module unless HAS_GRPC installed or connecting to server
@@ -117,6 +126,11 @@ def test_connect_via_channel(mapdl):
     assert mapdl.is_alive
 
 
+def test_channel_state_not_subscribed(mapdl):
+    # only the instances of a pool track their channel state
+    assert mapdl._channel_state_callback is None
+
+
 def test_clear_nostart(mapdl):
     resp = mapdl._send_command("FINISH")
     resp = mapdl._send_command("/CLEAR, NOSTART")
@@ -156,6 +170,38 @@ def test_stream(mapdl):
     assert "PREP7" in resp
 
 
+def test_stream_on_output(mapdl):
+    chunks = []
+    resp = mapdl.run("/PREP7", on_output=chunks.append, stream_period=10)
+    assert chunks
+    assert "PREP7" in "".join(chunks)
+    assert "PREP7" in resp
+
+    with pytest.raises(ValueError, match="stream_period"):
+        mapdl.run("/PREP7", on_output=chunks.append, stream_period=0)
+
+
+def test_stream_on_output_bounded(mapdl, monkeypatch):
+    monkeypatch.setattr(mapdl_grpc, "STREAM_MAX_OUTPUT", 10)
+
+    chunks = []
+    resp = mapdl._send_command_stream("/STATUS", on_output=chunks.append)
+    assert len(chunks) > 1
+    assert len(resp) < len("".join(each.strip() for each in chunks))
+    assert resp.endswith(chunks[-1].strip())
+
+
+def test_stream_on_output_error(mapdl):
+    def callback(text):
+        raise RuntimeError("Stop streaming")
+
+    with pytest.raises(RuntimeError, match="Stop streaming"):
+        mapdl.run("/PREP7", on_output=callback)
+
+    # The session is still usable
+    assert "PREP7" in mapdl.prep7()
+
+
 def test_basic_input_output(mapdl, tmpdir):
     mapdl.finish()
     mapdl.clear("NOSTART")
@@ -187,6 +233,167 @@ def test_upload_large(mapdl):
     assert os.path.basename(file_name) in mapdl.list_files()
 
 
+def test_upload_cache(mapdl, tmpdir, monkeypatch):
+    file_name = f"cached_{random_string()}.inp"
+    record_name = file_name + UPLOAD_RECORD_SUFFIX
+    local_file = str(tmpdir.join(file_name))
+    with open(local_file, "w") as fid:
+        fid.write("/com, first version")
+
+    # Not cached by default
+    mapdl.upload(local_file, progress_bar=False)
+    assert record_name not in mapdl.list_files()
+
+    mapdl.upload(local_file, progress_bar=False, use_cache=True)
+    assert file_name in mapdl.list_files()
+    checksum, fingerprint = mapdl._read_upload_record(file_name)
+    assert checksum == file_checksum(local_file)
+
+    # Same content, nothing is sent.  The record lives in the MAPDL working
+    # directory, so it is also used by other sessions.
+    with monkeypatch.context() as m:
+        m.setattr(mapdl._stub, "UploadFile", None)
+        assert mapdl.upload(local_file, progress_bar=False, use_cache=True) == file_name
+
+    # New content
+    with open(local_file, "w") as fid:
+        fid.write("/com, second version, which is longer")
+    mapdl.upload(local_file, progress_bar=False, use_cache=True)
+    assert mapdl._read_upload_record(file_name)[0] != checksum
+    assert "second version" in mapdl._download_as_raw(file_name).decode()
+
+    # Removed from the MAPDL working directory
+    mapdl.slashdelete(file_name)
+    mapdl.upload(local_file, progress_bar=False, use_cache=True)
+    assert file_name in mapdl.list_files()
+    mapdl.slashdelete(file_name)
+    mapdl.slashdelete(record_name)
+
+
+def test_input_use_cache(mapdl, cleared, tmpdir, monkeypatch):
+    file_name = f"cached_{random_string()}.inp"
+    local_file = str(tmpdir.join(file_name))
+    with open(local_file, "w") as fid:
+        fid.write("/com, cached input\n")
+    # Go through the upload, as for remote instances
+    monkeypatch.setattr(mapdl, "_local", False)
+
+    mapdl.input(local_file, use_cache=True)
+    # Kept in the MAPDL working directory to be reused
+    assert file_name in mapdl.list_files()
+
+    with monkeypatch.context() as m:
+        m.setattr(mapdl._stub, "UploadFile", None)
+        out = mapdl.input(local_file, use_cache=True)
+    assert "cached input" in out.lower()
+
+    # Without the cache, the uploaded file is removed once read
+    mapdl.input(local_file)
+    assert file_name not in mapdl.list_files()
+    mapdl.slashdelete(file_name + UPLOAD_RECORD_SUFFIX)
+    mapdl.upload(local_file, progress_bar=False, use_cache=True)
+    assert file_name in mapdl.list_files()
+    mapdl.slashdelete(file_name)
+
+
+def test_upload_raw_on_new_channel(mapdl):
+    file_name = f"raw_{random_string()}.abt"
+    mapdl._upload_raw_on_new_channel(b"nonlinear\n", file_name)
+    assert mapdl._download_as_raw(file_name) == b"nonlinear\n"
+    mapdl.slashdelete(file_name)
+
+
+def test_adaptive_chunk_size():
+    chunk_size = AdaptiveChunkSize(target_time=0.1, smoothing=1)
+    assert chunk_size.size == DEFAULT_CHUNKSIZE
+
+    # Latency dominated transfers are ignored
+    chunk_size.record(1024, 1)
+    assert chunk_size.throughput is None
+
+    chunk_size.record(10 * 1024**2, 10)  # 1 MB/s
+    assert chunk_size.size == 128 * 1024
+
+    chunk_size.record(1024**3, 1)
+    assert chunk_size.size == MAX_CHUNKSIZE
+
+    chunk_size.record(1024**2, 100)
+    assert chunk_size.size == MIN_CHUNKSIZE
+
+
+@pytest.mark.parametrize(
+    "kwargs,match",
+    [
+        [{"compression": "zip"}, "compression 'zip' is not supported"],
+        [{"chunk_size": "big"}, "must be an integer or 'auto'"],
+        [{"chunk_size": 8 * 1024**2}, "not larger than 4 MB"],
+        [{"chunk_size": 0}, "not larger than 4 MB"],
+    ],
+)
+def test_invalid_transfer_options(kwargs, match):
+    with pytest.raises(ValueError, match=match):
+        mapdl_grpc.MapdlGrpc(**kwargs)
+
+
+@pytest.mark.benchmark
+@pytest.mark.parametrize("compression", [None, "gzip"])
+@pytest.mark.parametrize("chunk_size", [None, "auto"])
+def test_transfer_benchmark(
+    mapdl, tmpdir, monkeypatch, record_property, compression, chunk_size
+):
+    """Upload and download a text file through a 4 MB/s link with 5 ms of latency.
+
+    The transfer times are recorded as properties of the test report.
+    """
+    file_name = f"bench_{random_string()}.cdb"
+    local_file = str(tmpdir.join(file_name))
+    with open(local_file, "w") as fid:
+        for i in range(60000):
+            fid.write(f"{i:9d}{i * 0.1:20.13E}{i * 0.2:20.13E}{i * 0.3:20.13E}\n")
+    n_bytes = os.path.getsize(local_file)
+
+    proxy = ThrottledProxy(mapdl._ip, mapdl._port, bandwidth=4 * 1024**2, latency=0.005)
+    with proxy:
+        monkeypatch.setattr(mapdl, "_compression", compression)
+        monkeypatch.setattr(
+            mapdl,
+            "_adaptive_chunk_size",
+            AdaptiveChunkSize() if chunk_size == "auto" else None,
+        )
+        channel = mapdl._create_channel("127.0.0.1", proxy.port)
+        monkeypatch.setattr(mapdl, "_channel", channel)
+        monkeypatch.setattr(mapdl, "_stub", MapdlServiceStub(channel))
+
+        timings = {}
+        for repetition in range(2):  # the second one uses the adapted chunk size
+            tstart = time.time()
+            mapdl.upload(local_file, progress_bar=False, use_cache=False)
+            timings[f"upload {repetition}"] = time.time() - tstart
+
+            out_file = str(tmpdir.join(f"out_{repetition}_{file_name}"))
+            tstart = time.time()
+            mapdl._download(file_name, out_file_name=out_file)
+            timings[f"download {repetition}"] = time.time() - tstart
+
+            with open(local_file, "rb") as fid1, open(out_file, "rb") as fid2:
+                assert fid1.read() == fid2.read()
+
+        if chunk_size == "auto":
+            # The chunk size follows the throughput measured through the proxy
+            adaptive = mapdl._adaptive_chunk_size
+            assert adaptive.throughput is not None
+            assert MIN_CHUNKSIZE <= adaptive.size <= MAX_CHUNKSIZE
+            if compression is None:
+                assert adaptive.throughput <= 1.1 * proxy.bandwidth
+
+        channel.close()
+
+    monkeypatch.undo()
+    mapdl.slashdelete(file_name)
+    for key, value in timings.items():
+        record_property(f"{key} [MB/s]", round(n_bytes / value / 1024**2, 2))
+
+
 def test_upload_fail(mapdl):
     with pytest.raises(FileNotFoundError):
         mapdl.upload("thisisnotafile")
@@ -264,6 +471,17 @@ def test_read_input_file(mapdl, file_name):
     )
 
 
+def test_non_interactive_large_block(mapdl):
+    n_commands = 20000
+    with mapdl.non_interactive:
+        for i in range(n_commands):
+            mapdl.run(f"MYPAR = {i}")
+
+    assert mapdl.scalar_param("MYPAR") == n_commands - 1
+    # The streamed input file is removed once it has run
+    assert not [each for each in mapdl.list_files() if each.startswith("tmp_")]
+
+
 def test_no_get_value_non_interactive(mapdl):
     with pytest.raises((MapdlRuntimeError, MapdlCommandIgnoredError)):
         with mapdl.non_interactive:
@@ -297,6 +515,38 @@ def test__download(mapdl, tmpdir):
     assert out_file.exists()
 
 
+@pytest.mark.parametrize("partial", [b"dummy", b"wrong_content", b""])
+def test__download_overwrites_partial_file(mapdl, tmpdir, partial):
+    write_tmp_in_mapdl_instance(mapdl, "myfile0")
+    file_name = "myfile0.txt"
+    content = mapdl._download_as_raw(file_name)
+
+    # Leftover of an interrupted download
+    out_file = str(tmpdir.join("out_" + file_name))
+    with open(out_file + ".part", "wb") as fid:
+        fid.write(partial)
+
+    mapdl._download(file_name, out_file_name=out_file)
+
+    assert not os.path.exists(out_file + ".part")
+    with open(out_file, "rb") as fid:
+        assert fid.read() == content
+
+
+@pytest.mark.parametrize("max_workers", [1, 2])
+def test_download_parallel(mapdl, tmpdir, max_workers):
+    files = [f"myfile{i}.txt" for i in range(4)]
+    for each in files:
+        write_tmp_in_mapdl_instance(mapdl, os.path.splitext(each)[0])
+
+    out_files = mapdl._download_files(files, str(tmpdir), max_workers=max_workers)
+
+    assert out_files == [os.path.join(str(tmpdir), each) for each in files]
+    for each, out_file in zip(files, out_files):
+        with open(out_file, "rb") as fid:
+            assert fid.read() == mapdl._download_as_raw(each)
+
+
 @pytest.mark.parametrize(
     "files_to_download,expected_output",
     [
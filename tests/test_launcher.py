@@ -35,6 +35,7 @@ from ansys.mapdl.core.errors import (
     DeprecationError,
     LicenseServerConnectionError,
     MapdlDidNotStart,
+    MapdlRuntimeError,
     NotEnoughResources,
     PortAlreadyInUseByAnMAPDLInstance,
 )
@@ -687,3 +688,126 @@ def test_ip_and_start_instance(
             assert options["ip"] == ip
         else:
             assert options["ip"] in (LOCALHOST, "0.0.0.0")
+
+
+def test_warm_pool_requests(tmpdir):
+    from ansys.mapdl.core.warm_pool import (
+        WarmPool,
+        acquire_warm_instance,
+        get_warm_pool_address,
+        request_warm_pool,
+    )
+
+    state_file = str(tmpdir.join("warm_pool.json"))
+    pool = WarmPool(1, state_file=state_file)
+    pool._refill = lambda: None  # do not launch MAPDL
+    pool._ready.append(
+        {"ip": LOCALHOST, "port": 50200, "pid": os.getpid(), "directory": ""}
+    )
+
+    pool.start()
+    try:
+        address = pool.address
+        assert get_warm_pool_address(state_file) == address
+        assert os.stat(state_file).st_mode & 0o077 == 0
+        status = request_warm_pool("status", state_file=state_file)
+        assert status["ready"] == 1
+
+        # Requests without the token of the state file are refused
+        with pytest.raises(MapdlRuntimeError, match="token"):
+            request_warm_pool("status", address=address)
+
+        # Instances launched with other options are not handed over
+        launch_kwargs = {"nproc": 4, "jobname": "other"}
+        assert pool.mismatched_options(launch_kwargs) == ["nproc", "jobname"]
+        assert (
+            acquire_warm_instance(launch_kwargs=launch_kwargs, state_file=state_file)
+            is None
+        )
+        assert request_warm_pool("status", state_file=state_file)["ready"] == 1
+
+        instance = acquire_warm_instance(state_file=state_file)
+        assert instance["port"] == 50200
+        assert instance["pid"] == os.getpid()
+
+        # No ready instances left
+        assert acquire_warm_instance(state_file=state_file) is None
+        status = request_warm_pool("status", state_file=state_file)
+        assert status["ready"] == 0
+        assert status["handed_over"] == 1
+    finally:
+        pool.stop()
+
+    assert not os.path.exists(state_file)
+    assert request_warm_pool("status", address=address) is None
+
+
+def test_launch_mapdl_prewarmed_without_warm_pool(monkeypatch, tmpdir):
+    from ansys.mapdl.core import warm_pool
+    from ansys.mapdl.core.launcher import _connect_to_warm_instance
+
+    monkeypatch.setattr(
+        warm_pool, "WARM_POOL_STATE_FILE", str(tmpdir.join("warm_pool.json"))
+    )
+    assert warm_pool.acquire_warm_instance() is None
+    assert _connect_to_warm_instance() is None
+
+
+def test_reserve_ports():
+    from ansys.mapdl.core.launcher import (
+        PortReservation,
+        port_in_use_using_socket,
+        reserve_ports,
+    )
+
+    reservations = reserve_ports(3, 50300)
+    ports = [each.port for each in reservations]
+    assert len(set(ports)) == 3
+    assert all(port >= 50300 for port in ports)
+
+    try:
+        for port in ports:
+            assert port_in_use_using_socket(port, LOCALHOST)
+            with pytest.raises(OSError):
+                PortReservation(port)
+
+        # The held ports are skipped
+        other = reserve_ports(1, ports[0])[0]
+        assert other.port not in ports
+        other.release()
+
+    finally:
+        for each in reservations:
+            each.release()
+
+    for each in reservations:
+        assert not each.held
+        assert not port_in_use_using_socket(each.port, LOCALHOST)
+
+
+def test_launch_mapdl_instances_arguments():
+    from ansys.mapdl.core.launcher import launch_mapdl_instances
+
+    with pytest.raises(ValueError, match="at least 1 instance"):
+        launch_mapdl_instances(0)
+
+    with pytest.raises(ValueError, match="'port' cannot be used"):
+        launch_mapdl_instances(2, port=50052)
+
+
+@requires("local")
+@requires("nostudent")
+def test_launch_mapdl_instances():
+    from ansys.mapdl.core.launcher import launch_mapdl_instances
+
+    instances = launch_mapdl_instances(
+        2, starting_port=50320, additional_switches=QUICK_LAUNCH_SWITCHES
+    )
+    try:
+        assert len({each.port for each in instances}) == 2
+        for mapdl in instances:
+            timings = mapdl.startup_timings
+            assert set(timings) == {"port_reservation", "launch", "connect"}
+    finally:
+        for mapdl in instances:
+            mapdl.exit()
@@ -49,11 +49,19 @@ from ansys.mapdl.core.errors import (
     IncorrectWorkingDirectory,
     MapdlCommandIgnoredError,
     MapdlConnectionError,
+    MapdlInvalidRoutineError,
     MapdlRuntimeError,
 )
 from ansys.mapdl.core.launcher import launch_mapdl
-from ansys.mapdl.core.mapdl_grpc import SESSION_ID_NAME
+from ansys.mapdl.core.mapdl_grpc import (
+    SESSION_CHECK_INTERVAL,
+    SESSION_ID_NAME,
+    SESSION_KEY_NAME,
+    MapdlGrpc,
+    _session_key,
+)
 from ansys.mapdl.core.misc import random_string
+from ansys.mapdl.core.profiler import CommandProfiler
 from conftest import IS_SMP, ON_CI, ON_LOCAL, QUICK_LAUNCH_SWITCHES, requires
 
 # Path to files needed for examples
@@ -1627,6 +1635,53 @@ def test_non_interactive(mapdl, cleared):
     assert mapdl.get_value("KP", 0, "count") == 2
 
 
+def test_batching(mapdl, cleared):
+    with mapdl.batching:
+        mapdl.prep7()
+        for i in range(1, 11):
+            mapdl.n(i, i, 0, 0)
+        assert len(mapdl._batch) >= 11
+
+        # requesting a value flushes the queued commands
+        assert mapdl.get_value("NODE", 0, "COUNT") == 10
+        assert not mapdl._batch
+
+        assert mapdl.run("N,11,11,0,0") is None
+
+        # probing the server does not flush the queued commands
+        assert mapdl.is_alive
+        assert mapdl._batch
+
+    assert not mapdl._batch
+    assert mapdl.mesh.n_node == 11
+
+
+def test_batching_error(mapdl, cleared):
+    with pytest.raises(MapdlInvalidRoutineError, match="K,1,0,0,0"):
+        with mapdl.batching:
+            mapdl.slashsolu()
+            mapdl.k(1, 0, 0, 0)
+
+    assert not mapdl._batch
+
+
+@pytest.mark.parametrize(
+    "command,batchable",
+    [
+        ("N,1,0,0,0", True),
+        ("/PREP7", True),
+        ("*GET,PAR,NODE,0,COUNT", False),
+        ("NLIST", False),
+        ("PRNSOL,U,X", False),
+        ("*STATUS", False),
+        ("EPLOT", False),
+        ("/CLEAR,NOSTART", False),
+    ],
+)
+def test_is_batchable(command, batchable):
+    assert MapdlGrpc._is_batchable(command) is batchable
+
+
 def test_ignored_command(mapdl, cleared):
     mapdl.ignore_errors = False
     mapdl.prep7(mute=True)
@@ -1891,6 +1946,7 @@ def test_force_output(mapdl):
 
 def test_session_id(mapdl, running_test):
     mapdl._strict_session_id_check = True
+    mapdl._session_check_interval = 0
     assert mapdl._session_id is not None
 
     # already checking version
@@ -1911,6 +1967,7 @@ def test_session_id(mapdl, running_test):
     id_ = "123412341234"
     mapdl._session_id_ = id_
     mapdl._run(f"{SESSION_ID_NAME}='{id_}'")
+    mapdl._run(f"{SESSION_KEY_NAME}={_session_key(id_)}")
     assert mapdl._check_session_id()
 
     mapdl._session_id_ = "qwerqwerqwer"
@@ -1918,6 +1975,75 @@ def test_session_id(mapdl, running_test):
 
     mapdl._session_id_ = id_
     mapdl._strict_session_id_check = False
+    mapdl._session_check_interval = SESSION_CHECK_INTERVAL
+
+
+def test_session_id_check_interval(mapdl):
+    mapdl._strict_session_id_check = True
+    try:
+        mapdl._last_session_check = 0.0
+        assert mapdl._check_session_id()
+
+        # Not checked again until the interval has passed
+        assert mapdl._check_session_id() is None
+    finally:
+        mapdl._strict_session_id_check = False
+
+
+def test_session_id_check_detects_change(mapdl):
+    id_ = mapdl._session_id_
+    mapdl._strict_session_id_check = True
+    mapdl._session_check_interval = 0.5
+    try:
+        mapdl._last_session_check = 0.0
+        assert mapdl._check_session_id()
+
+        # Another client takes over the MAPDL session
+        mapdl._run(f"{SESSION_KEY_NAME}={_session_key('another_session')}")
+
+        # Not detected until the interval has passed
+        assert mapdl._check_session_id() is None
+
+        time.sleep(0.5)
+        assert mapdl._check_session_id() is False
+
+        # Checked again on the next command
+        assert mapdl._check_session_id() is False
+    finally:
+        mapdl._run(f"{SESSION_KEY_NAME}={_session_key(id_)}")
+        mapdl._strict_session_id_check = False
+        mapdl._session_check_interval = SESSION_CHECK_INTERVAL
+
+
+@pytest.mark.benchmark
+def test_session_id_check_benchmark(mapdl, record_property):
+    n_commands = 200
+
+    def time_per_command(strict, interval):
+        mapdl._strict_session_id_check = strict
+        mapdl._session_check_interval = interval
+        mapdl._last_session_check = 0.0
+        tstart = time.perf_counter()
+        for _ in range(n_commands):
+            mapdl.run("/COM")
+        return (time.perf_counter() - tstart) / n_commands
+
+    try:
+        time_no_check = time_per_command(False, SESSION_CHECK_INTERVAL)
+        time_check_every_command = time_per_command(True, 0)
+        time_check_interval = time_per_command(True, SESSION_CHECK_INTERVAL)
+    finally:
+        mapdl._strict_session_id_check = False
+        mapdl._session_check_interval = SESSION_CHECK_INTERVAL
+
+    record_property("time_no_check", time_no_check)
+    record_property("time_check_every_command", time_check_every_command)
+    record_property("time_check_interval", time_check_interval)
+    record_property(
+        "overhead_check_every_command", time_check_every_command - time_no_check
+    )
+    record_property("overhead_check_interval", time_check_interval - time_no_check)
+    assert time_check_interval < time_check_every_command
 
 
 def test_check_empty_session_id(mapdl):
@@ -2452,3 +2578,70 @@ def test_not_correct_et_element(mapdl):
 def test_ctrl(mapdl):
     mapdl._ctrl("set_verb", 5)  # Setting verbosity on the server
     mapdl._ctrl("set_verb", 0)  # Returning to non-verbose
+
+
+def test_command_profiler():
+    profiler = CommandProfiler(latency=0.01)
+
+    outer = profiler._begin("K,1,0,0,0")
+    profiler._span("rpc", outer.start, outer.start + 0.05)
+    inner = profiler._begin("/SHOW,PNG")
+    profiler._end(inner)
+    profiler._span("parse", outer.start + 0.05, outer.start + 0.06)
+    profiler._end(outer)
+    assert outer.children == inner.duration
+
+    # Fixed durations
+    outer.end = outer.start + 0.1
+    outer.children = 0.02
+
+    record = profiler.records[0]
+    assert record["client"] == pytest.approx(0.02)
+    assert record["name"] == "K"
+    assert record["transit"] == pytest.approx(0.01)
+    assert record["server"] == pytest.approx(0.04)
+    assert record["parse"] == pytest.approx(0.01)
+
+    summary = profiler.summary()
+    assert set(summary) == {"K", "/SHOW"}
+    assert summary["K"]["count"] == 1
+    assert summary["K"]["total"] == pytest.approx(
+        sum(summary["K"][phase] for phase in ["client", "transit", "server", "parse"])
+    )
+
+    trace = profiler.to_chrome_trace()
+    assert [each["name"] for each in trace["traceEvents"]] == [
+        "K",
+        "rpc",
+        "/SHOW",
+        "parse",
+    ]
+    assert "K" in str(profiler)
+
+
+def test_profile(mapdl, cleared, tmpdir):
+    with mapdl.profile() as profiler:
+        mapdl.prep7()
+        for i in range(1, 11):
+            mapdl.k(i, i, 0, 0)
+
+        with pytest.raises(MapdlRuntimeError):
+            with mapdl.profile():
+                pass
+
+    assert mapdl._profiler is None
+    assert profiler.latency > 0
+
+    summary = profiler.summary()
+    assert summary["K"]["count"] == 10
+    assert summary["/PREP7"]["count"] == 1
+    assert summary["K"]["server"] > 0
+
+    filename = str(tmpdir.join("trace.json"))
+    profiler.to_chrome_trace(filename)
+    with open(filename, "r") as fid:
+        assert "traceEvents" in fid.read()
+
+    # Nothing is recorded once the context manager is left
+    mapdl.k(11, 11, 0, 0)
+    assert profiler.summary()["K"]["count"] == 10
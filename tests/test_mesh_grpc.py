@@ -22,6 +22,8 @@
 
 """Test mesh """
 import os
+import time
+import types
 
 import numpy as np
 import pytest
@@ -32,6 +34,7 @@ if has_dependency("pyvista"):
     import pyvista as pv
 
 from ansys.mapdl.core import examples
+from ansys.mapdl.core.mesh_grpc import ElementArrays
 
 
 def test_empty_model(mapdl):
@@ -66,6 +69,53 @@ def test_elem_num_in_mesh_elem(mapdl, cube_geom_and_mesh):
     assert np.allclose(mapdl.mesh.enum, enums)
 
 
+def test_elem_csr(mapdl, cube_geom_and_mesh):
+    elements = mapdl.mesh.elem
+    assert len(elements) == mapdl.mesh.n_elem
+    assert np.allclose(elements.enum, mapdl.mesh.enum)
+    assert elements.attributes.shape == (len(elements), 10)
+    assert elements.offsets[-1] == elements.connectivity.size
+    assert elements.material_type.flags.contiguous
+
+    assert np.allclose(elements.material_type, mapdl.mesh.material_type)
+    assert np.allclose(elements.section, mapdl.mesh.section)
+    assert np.allclose(elements.element_type, mapdl.mesh.et_id)
+
+    enum = mapdl.mesh.enum[[0, -1]]
+    rows = elements.row(enum)
+    assert np.allclose(elements.enum[rows], enum)
+    assert elements.row(enum.max() + 1) == -1
+
+    for row in rows:
+        assert np.allclose(elements.nodes(row), elements[row][10:])
+
+    # Slices behave as with the former list of elements
+    assert [each[8] for each in elements[:3]] == list(elements.enum[:3])
+    assert [each[8] for each in elements[::-1]] == list(elements.enum[::-1])
+    assert elements[len(elements) :] == []
+    with pytest.raises(TypeError):
+        elements[1.0]
+
+
+@requires("pyvista")
+def test_linear_surf_cache(mapdl, cube_geom_and_mesh):
+    surf = mapdl.mesh._linear_surf
+    assert surf.n_cells > 0
+    assert mapdl.mesh._linear_surf is surf
+
+    # eplot plots a copy of the cached surface
+    pl = mapdl.eplot(return_plotter=True, off_screen=True)
+    assert pl.meshes[0] is not surf
+    assert pl.meshes[0].n_cells == surf.n_cells
+    pl.close()
+    assert mapdl.mesh._linear_surf is surf
+
+    # Rebuilt once the mesh changes
+    mapdl.esel("S", "ELEM", "", 1)
+    assert mapdl.mesh._linear_surf is not surf
+    mapdl.allsel()
+
+
 def test_repr(mapdl, cube_geom_and_mesh):
     out = str(mapdl.mesh)
 
@@ -95,8 +145,10 @@ def test_empty_mesh(mapdl, cleared):
     assert mapdl.mesh.nodes.size == 0
     # assert mapdl.mesh.node_angles.size == 0 Not implemented
 
-    # elem is a list
+    assert isinstance(mapdl.mesh.elem, ElementArrays)
     assert len(mapdl.mesh.elem) == 0
+    assert mapdl.mesh.elem.attributes.shape == (0, 10)
+    assert list(mapdl.mesh.elem) == []
 
     # Using size because it should be empty arrays
     assert mapdl.mesh.ekey.size == 0
@@ -246,6 +298,270 @@ def test_save(mapdl, cube_geom_and_mesh):
         os.remove(fname)
 
 
+@requires("pyvista")
+@pytest.mark.parametrize("force_linear", [False, True])
+def test_save_stream(mapdl, cube_geom_and_mesh, tmpdir, force_linear):
+    fname = str(tmpdir.join("mesh.vtu"))
+    mapdl.mesh.save(fname, force_linear=force_linear, stream=True)
+
+    grid = pv.read(fname)
+    ref = mapdl.mesh._parse_vtk(force_linear=force_linear)
+    assert grid.n_cells == ref.n_cells
+    assert np.allclose(grid.points, mapdl.mesh.nodes)
+    assert np.allclose(grid.celltypes, ref.celltypes)
+    assert np.allclose(grid.cell_connectivity, ref.cell_connectivity)
+    for name in [
+        "ansys_elem_num",
+        "ansys_real_constant",
+        "ansys_material_type",
+        "ansys_etype",
+        "ansys_elem_type_num",
+    ]:
+        assert np.allclose(grid.cell_data[name], ref.cell_data[name])
+    assert np.allclose(grid.point_data["ansys_node_num"], mapdl.mesh.nnum)
+
+
+@requires("pyvista")
+def test_save_stream_small_chunks(mapdl, cube_geom_and_mesh, tmpdir):
+    from ansys.mapdl.core.mesh.export import save_stream
+
+    # chunks smaller than an element, so the elements are reassembled
+    mesh = mapdl.mesh
+    batches = list(mesh._iter_elements(chunk_size=256))
+    assert len(batches) > 1
+    elem = np.concatenate([batch for batch, _ in batches])
+    assert elem.size == mesh._elem.size
+
+    # the element numbers are only written to the cached elements
+    mask = np.ones(elem.size, np.bool_)
+    mask[mesh._elem_off[:-1] + 8] = False
+    assert np.array_equal(elem[mask], mesh._elem[mask])
+
+    fname = str(tmpdir.join("mesh.vtu"))
+    save_stream(
+        fname,
+        mesh,
+        mesh._iter_nodes(chunk_size=256),
+        mesh._iter_elements(chunk_size=256),
+    )
+
+    grid = pv.read(fname)
+    ref = mesh._parse_vtk()
+    assert grid.n_cells == ref.n_cells
+    assert np.allclose(grid.points, mesh.nodes)
+    assert np.allclose(grid.celltypes, ref.celltypes)
+    assert np.allclose(grid.cell_connectivity, ref.cell_connectivity)
+
+
+@requires("h5py")
+def test_save_stream_hdf5(mapdl, cube_geom_and_mesh, tmpdir):
+    import h5py
+
+    fname = str(tmpdir.join("mesh.vtkhdf"))
+    mapdl.mesh.save(fname, stream=True)
+
+    with h5py.File(fname, "r") as fid:
+        root = fid["VTKHDF"]
+        assert root.attrs["Type"] == b"UnstructuredGrid"
+        assert root["NumberOfCells"][0] == mapdl.mesh.n_elem
+        assert root["NumberOfPoints"][0] == mapdl.mesh.n_node
+        assert np.allclose(root["Points"][:], mapdl.mesh.nodes)
+        assert np.allclose(root["CellData/ansys_elem_num"][:], mapdl.mesh.enum)
+        assert root["Offsets"][-1] == root["Connectivity"].shape[0]
+
+
+def test_save_stream_invalid(mapdl, cube_geom_and_mesh, tmpdir):
+    with pytest.raises(ValueError, match="Invalid file extension"):
+        mapdl.mesh.save(str(tmpdir.join("mesh.vtk")), stream=True)
+
+
+@requires("pyvista")
+def test_grid_selection_delta(mapdl, cube_geom_and_mesh):
+    mapdl.allsel()
+    grid = mapdl.mesh.grid
+    full_grid = mapdl.mesh._full_grid_cache
+    assert full_grid is not None
+    assert grid.n_cells == mapdl.mesh.n_elem
+
+    # selection commands keep the whole model cached
+    mapdl.esel("S", "ELEM", "", 1, 10)
+    grid = mapdl.mesh.grid
+    assert mapdl.mesh._full_grid_cache is full_grid
+    assert grid.n_cells == 10
+    assert np.allclose(np.sort(grid.cell_data["ansys_elem_num"]), mapdl.mesh.enum)
+    assert np.isin(mapdl.mesh.nnum, grid.point_data["ansys_node_num"]).all()
+
+    mapdl.esel("NONE")
+    assert mapdl.mesh.grid is None
+
+    # other commands reset it
+    mapdl.allsel()
+    assert mapdl.mesh._full_grid_cache is full_grid
+    mapdl.prep7()
+    assert mapdl.mesh._full_grid_cache is None
+    assert mapdl.mesh.grid.n_cells == mapdl.mesh.n_elem
+
+
+@requires("pyvista")
+def test_grid_missing_midside(mapdl, cleared):
+    mapdl.block(0, 1, 0, 1, 0, 1)
+    mapdl.et(1, 186)
+    mapdl.esize(0.25)
+    mapdl.vmesh("all")
+    mapdl.emid("REMOVE", "BOTH")
+
+    grid = mapdl.mesh.grid
+    assert grid.n_cells == mapdl.mesh.n_elem
+    assert (grid.celltypes == pv.CellType.QUADRATIC_HEXAHEDRON).all()
+    assert grid.cell_connectivity.min() >= 0
+
+    # new midside nodes are unnumbered and placed on their edges
+    nnum = grid.point_data["ansys_node_num"]
+    assert (nnum == -1).sum() == grid.n_points - mapdl.mesh.n_node
+    assert np.allclose(grid.points.min(axis=0), 0)
+    assert np.allclose(grid.points.max(axis=0), 1)
+    assert np.allclose(np.unique(grid.points), np.arange(9) / 8)
+
+
+def synthetic_hex20_mesh(n_div):
+    """Mesh-like object with ``n_div**3`` SOLID186 elements in a unit cube.
+
+    Nodes are placed on a lattice of half element sizes.
+    """
+    n_lat = 2 * n_div + 1
+    ijk = np.indices((n_lat, n_lat, n_lat)).reshape(3, -1).T
+    nnum = np.arange(1, ijk.shape[0] + 1, dtype=np.int32)
+
+    # SOLID186 node order, corners followed by the edge midpoints
+    corners = np.array(
+        [[0, 0, 0], [2, 0, 0], [2, 2, 0], [0, 2, 0]]
+        + [[0, 0, 2], [2, 0, 2], [2, 2, 2], [0, 2, 2]]
+    )
+    edges = [(0, 1), (1, 2), (2, 3), (3, 0), (4, 5), (5, 6), (6, 7), (7, 4)]
+    edges += [(0, 4), (1, 5), (2, 6), (3, 7)]
+    local = np.vstack([corners] + [(corners[a] + corners[b]) // 2 for a, b in edges])
+
+    base = 2 * np.indices((n_div, n_div, n_div)).reshape(3, -1).T
+    lat = base[:, None, :] + local[None, :, :]
+    elem_nodes = (lat[..., 0] * n_lat + lat[..., 1]) * n_lat + lat[..., 2] + 1
+
+    n_elem = base.shape[0]
+    enum = np.arange(1, n_elem + 1, dtype=np.int32)
+    header = np.zeros((n_elem, 10), np.int32)
+    header[:, :4] = 1  # material, type, real and section
+    header[:, 8] = enum
+    elem = np.hstack((header, elem_nodes)).astype(np.int32)
+    ones = np.ones(n_elem, np.int32)
+
+    return types.SimpleNamespace(
+        _has_nodes=True,
+        _has_elements=True,
+        _ekey=np.array([[1, 186]]),
+        _elem=elem.ravel(),
+        _elem_off=np.arange(n_elem + 1, dtype=np.int32) * elem.shape[1],
+        _ans_etype=ones * 186,
+        nodes=ijk / (n_lat - 1),
+        node_angles=np.zeros((nnum.size, 3)),
+        nnum=nnum,
+        enum=enum,
+        elem_real_constant=ones,
+        material_type=ones,
+        etype=ones,
+    )
+
+
+def fix_missing_midside_reference(cells, nodes, celltypes, offset, angles, nnum):
+    """Former ``fix_missing_midside``, which processes the whole mesh."""
+    from ansys.mapdl.reader import _relaxmidside
+    from ansys.mapdl.reader.misc import unique_rows
+
+    mask = cells == -1
+    nnodes = nodes.shape[0]
+
+    nextra = mask.sum()
+    cells[mask] = np.arange(nnodes, nnodes + nextra)
+
+    nodes_new = np.empty((nnodes + nextra, 3))
+    nodes_new[:nnodes] = nodes
+    nodes_new[nnodes:] = 0
+
+    temp_nodes = nodes_new.copy()
+    _relaxmidside.reset_midside(cells, celltypes, offset, temp_nodes)
+
+    unique_nodes, idx_a, idx_b = unique_rows(temp_nodes[nnodes:])
+
+    cells[mask] = idx_b + nnodes
+    nextra = idx_a.shape[0]
+    nodes_new = nodes_new[: nnodes + nextra]
+    nodes_new[nnodes:] = unique_nodes
+
+    if angles is not None:
+        new_angles = np.empty((nnodes + nextra, 3))
+        new_angles[:nnodes] = angles
+        new_angles[nnodes:] = 0
+    else:
+        new_angles = None
+
+    nnum_new = np.empty(nnodes + nextra)
+    nnum_new[:nnodes] = nnum
+    nnum_new[nnodes:] = -1
+    return nodes_new, new_angles, nnum_new
+
+
+@pytest.mark.benchmark
+@requires("pyvista")
+@requires("ansys.mapdl.reader")
+@pytest.mark.parametrize("missing", [0.0, 0.01, 0.1, 1.0])
+def test_parse_vtk_missing_midside_benchmark(missing, monkeypatch, record_property):
+    """Convert a synthetic SOLID186 mesh where some elements miss their
+    midside nodes, with the current and the former ``fix_missing_midside``.
+    """
+    from ansys.mapdl.core.mesh import mesh as mesh_module
+
+    n_div = 30
+    n_elem = n_div**3
+    mesh = synthetic_hex20_mesh(n_div)
+    n_node = mesh.nnum.size
+
+    # remove the midside nodes of a random fraction of the elements
+    rng = np.random.default_rng(0)
+    affected = rng.permutation(n_elem)[: int(round(missing * n_elem))]
+    mesh._elem.reshape(-1, 30)[affected, 18:] = 0
+
+    tstart = time.perf_counter()
+    grid = mesh_module._parse_vtk(mesh)
+    time_parse_vtk = time.perf_counter() - tstart
+
+    with monkeypatch.context() as m:
+        m.setattr(mesh_module, "fix_missing_midside", fix_missing_midside_reference)
+        tstart = time.perf_counter()
+        grid_reference = mesh_module._parse_vtk(mesh)
+        time_parse_vtk_reference = time.perf_counter() - tstart
+
+    record_property("missing_fraction", missing)
+    record_property("time_parse_vtk", time_parse_vtk)
+    record_property("time_parse_vtk_reference", time_parse_vtk_reference)
+
+    assert grid.n_cells == n_elem
+    assert (grid.celltypes == pv.CellType.QUADRATIC_HEXAHEDRON).all()
+    assert grid.cell_connectivity.min() >= 0
+    assert np.array_equal(grid.cell_connectivity, grid_reference.cell_connectivity)
+    assert np.allclose(grid.points, grid_reference.points)
+
+    # one new node per unique edge of the affected elements, placed at
+    # its midpoint
+    n_new = grid.n_points - n_node
+    if missing == 0:
+        assert n_new == 0
+    elif missing == 1:
+        assert n_new == 3 * n_div * (n_div + 1) ** 2
+    else:
+        assert 0 < n_new <= 12 * affected.size
+    assert (grid.point_data["ansys_node_num"][n_node:] == -1).all()
+    lattice = grid.points[n_node:] * 2 * n_div
+    assert np.allclose(lattice, np.round(lattice))
+
+
 def test_key_option(mapdl, contact_geom_and_mesh):
     assert mapdl.mesh.key_option is not None
     assert isinstance(mapdl.mesh.key_option, dict)
@@ -22,6 +22,7 @@
 
 """Unit tests regarding plotting."""
 import os
+import time
 
 import numpy as np
 import pytest
@@ -34,7 +35,7 @@ if not has_dependency("pyvista"):
 from pyvista.plotting import Plotter
 
 from ansys.mapdl.core.errors import ComponentDoesNotExits
-from ansys.mapdl.core.plotting import general_plotter
+from ansys.mapdl.core.plotting import LOD_MIN_CELLS, _lod_actor, general_plotter
 
 FORCE_LABELS = [["FX", "FY", "FZ"], ["HEAT"], ["CHRG"]]
 DISPL_LABELS = [["UX", "UY", "UZ"], ["TEMP"], ["VOLT"]]
@@ -1099,3 +1100,76 @@ def test_node_numbering_order(mapdl, cleared):
     # There is no way to retrieve labels from the plotter object. So we cannot
     # test it.
     pl.show()
+
+
+def test_lod_actor():
+    import pyvista as pv
+    from vtkmodules.vtkRenderingLOD import vtkQuadricLODActor
+
+    mesh = pv.Sphere()
+    pl = Plotter(off_screen=True)
+    actor = pl.add_mesh(mesh, scalars=np.arange(mesh.n_points), show_scalar_bar=True)
+    mapper = actor.GetMapper()
+    scalar_bars = dict(pl.scalar_bars)
+    assert scalar_bars
+
+    lod_actor = _lod_actor(pl, actor)
+    assert isinstance(lod_actor, vtkQuadricLODActor)
+    assert lod_actor.GetMapper() is mapper
+    assert lod_actor.GetProperty() is actor.GetProperty()
+    assert lod_actor.GetDeferLODConstruction()
+
+    actors = list(pl.renderer.actors.values())
+    assert lod_actor in actors
+    assert actor not in actors
+    assert pl.renderer.GetActors().IsItemPresent(lod_actor)
+    assert not pl.renderer.GetActors().IsItemPresent(actor)
+
+    # The scalar bar of the mapper is kept
+    assert dict(pl.scalar_bars) == scalar_bars
+
+    pl.show(auto_close=False)
+    assert pl.screenshot() is not None
+    pl.close()
+
+
+@pytest.mark.benchmark
+def test_lod_actor_benchmark(record_property):
+    """Render times of a large mesh with and without the LOD actor."""
+    import pyvista as pv
+
+    n_div = 80  # 512000 cells
+    grid = pv.ImageData(dimensions=(n_div + 1,) * 3).cast_to_unstructured_grid()
+    assert grid.n_cells > LOD_MIN_CELLS
+
+    def render_times(lod):
+        pl = Plotter(off_screen=True)
+        actor = pl.add_mesh(grid, scalars=np.arange(grid.n_points))
+        if lod:
+            _lod_actor(pl, actor)
+
+        tstart = time.perf_counter()
+        pl.show(auto_close=False)
+        time_first = time.perf_counter() - tstart
+
+        # Update rate requested by the interactor while rotating the view.
+        # The first interactive render also builds the LOD proxy.
+        pl.render_window.SetDesiredUpdateRate(15)
+        times = []
+        for angle in range(5):
+            pl.camera.azimuth = angle
+            tstart = time.perf_counter()
+            pl.render()
+            times.append(time.perf_counter() - tstart)
+        pl.close()
+        return time_first, times[0], min(times[1:])
+
+    time_first, _, time_interactive = render_times(False)
+    time_first_lod, time_build_lod, time_interactive_lod = render_times(True)
+
+    record_property("time_first_render", time_first)
+    record_property("time_first_render_lod", time_first_lod)
+    record_property("time_build_lod", time_build_lod)
+    record_property("time_interactive_render", time_interactive)
+    record_property("time_interactive_render_lod", time_interactive_lod)
+    assert time_interactive_lod < time_interactive
@@ -23,6 +23,7 @@
 import os
 from pathlib import Path
 import socket
+import threading
 import time
 
 import numpy as np
@@ -41,6 +42,8 @@ else:
 from ansys.mapdl.core import Mapdl, MapdlPool, examples
 from ansys.mapdl.core.errors import VersionError
 from ansys.mapdl.core.launcher import LOCALHOST, MAPDL_DEFAULT_PORT
+from ansys.mapdl.core.misc import file_checksum
+from ansys.mapdl.core.pool_metrics import PoolMetrics
 from conftest import QUICK_LAUNCH_SWITCHES, NullContext, requires
 
 # skip entire module unless HAS_GRPC
@@ -147,6 +150,38 @@ def test_heal(pool):
     pool._verify_unique_ports()
 
 
+@skip_if_ignore_pool
+def test_single_monitor_thread(pool):
+    thread_names = [thread.name for thread in threading.enumerate()]
+    assert thread_names.count("Monitoring_Thread") == 1
+
+    for instance in pool:
+        # The pool monitor replaces the per-instance heartbeat
+        assert instance._heartbeat_stop.is_set()
+        assert instance._health_callbacks
+        assert instance._channel_state_callback is not None
+
+
+@skip_if_ignore_pool
+def test_heal_is_notified(pool):
+    pool_sz = len(pool)
+
+    # exiting one instance notifies the pool monitor straight away
+    notified = threading.Event()
+    instance = pool[0]
+    instance._health_callbacks.append(lambda mapdl: notified.set())
+    instance.exit()
+    assert notified.wait(1)
+
+    timeout = time.time() + TWAIT
+    while len(pool) < pool_sz:
+        time.sleep(0.1)
+        if time.time() > timeout:
+            raise TimeoutError(f"Failed to restart instance in {TWAIT} seconds")
+
+    assert len(pool) == pool_sz
+
+
 @skip_if_ignore_pool
 def test_simple_map(pool):
     pool_sz = len(pool)
@@ -765,3 +800,128 @@ def test_ip_port_n_instance(
         assert conf["ips"] == exp_ip
         assert conf["ports"] == exp_port
         assert conf["exec_file"] == "/ansys_inc/v222/ansys/bin/ansys222"
+
+
+@skip_if_ignore_pool
+def test_metrics(pool):
+    pool.metrics.reset()
+    outs = pool.map(lambda mapdl: mapdl.prep7())
+    assert len(outs) == len(pool)
+
+    metrics = pool.metrics.to_dict()
+    assert metrics["tasks"]["completed"] == len(pool)
+    assert metrics["tasks"]["queued"] == 0
+    assert metrics["tasks"]["running"] == 0
+    assert metrics["task_duration"]["count"] == len(pool)
+    for name in metrics["instances"]:
+        assert name.startswith("Instance_")
+
+
+def test_metrics_tasks():
+    metrics = PoolMetrics()
+    task = metrics.task_queued()
+    assert metrics.to_dict()["tasks"]["queued"] == 1
+
+    metrics.task_started(task, 0)
+    out = metrics.to_dict()
+    assert out["tasks"]["running"] == 1
+    assert out["instances"]["Instance_0"]["busy"]
+
+    metrics.task_finished(task, success=False)
+    metrics.instance_respawned(0)
+    out = metrics.to_dict()
+    assert out["tasks"] == {"queued": 0, "running": 0, "completed": 0, "failed": 1}
+    assert out["task_duration"]["count"] == 1
+    assert out["task_duration"]["buckets"]["+Inf"] == 1
+    assert out["respawns"] == 1
+    assert out["instances"]["Instance_0"]["tasks"] == 1
+
+
+def test_metrics_startup_timings():
+    metrics = PoolMetrics()
+    metrics.instance_spawned(0, {"port_reservation": 0.01, "launch": 5.0})
+    metrics.instance_spawned(1)
+
+    out = metrics.to_dict()
+    assert out["instances"]["Instance_0"]["startup"]["launch"] == 5.0
+    assert out["instances"]["Instance_1"]["startup"] == {}
+
+    text = metrics.to_prometheus()
+    assert (
+        'pymapdl_pool_instance_startup_seconds{instance="Instance_0",phase="launch"} 5.0'
+        in text
+    )
+
+
+def test_metrics_prometheus():
+    from urllib.request import urlopen
+
+    metrics = PoolMetrics(names=lambda i: f"my_instance_{i}")
+    task = metrics.task_queued()
+    metrics.task_started(task, 1)
+    metrics.task_finished(task)
+
+    text = metrics.to_prometheus()
+    assert 'pymapdl_pool_tasks_total{state="completed"} 1' in text
+    assert 'pymapdl_pool_task_duration_seconds_bucket{le="+Inf"} 1' in text
+    assert 'pymapdl_pool_instance_tasks_total{instance="my_instance_1"} 1' in text
+
+    server = metrics.serve(port=0)
+    try:
+        url = f"http://127.0.0.1:{server.server_port}"
+        assert 'state="completed"} 1' in urlopen(url + "/metrics").read().decode()
+        assert b'"completed": 1' in urlopen(url + "/json").read()
+    finally:
+        metrics.stop_server()
+
+
+@skip_if_ignore_pool
+def test_batch_shared_files(pool, tmpdir):
+    include = tmpdir.join("shared_include.inp")
+    include.write("/COM, shared include file\n")
+
+    input_file = tmpdir.join("main.inp")
+    input_file.write("/INPUT,shared_include,inp\n")
+
+    input_files = [str(input_file)] * (len(pool) + 2)
+    outputs = pool.run_batch(input_files, shared_files=[str(include)])
+    assert len(outputs) == len(input_files)
+
+    checksum = file_checksum(str(include))
+    assert any(
+        cache.get("shared_include.inp") == checksum
+        for cache in pool._shared_files_cache.values()
+    )
+
+
+def test_shared_files_are_sent_once(tmpdir):
+    pool = MapdlPool(ip=["127.0.0.1"], port=[50052], _debug_no_launch=True)
+
+    class FakeMapdl:
+        _local = False
+        uploaded = []
+
+        def upload(self, filename, progress_bar=False):
+            self.uploaded.append(filename)
+
+    shared = tmpdir.join("mesh.cdb")
+    shared.write("content")
+    mapdl = FakeMapdl()
+
+    files = pool._checksum_shared_files([str(shared)])
+    pool._sync_shared_files(mapdl, 0, files)
+    pool._sync_shared_files(mapdl, 0, files)
+    assert mapdl.uploaded == [str(shared)]
+
+    # other instances get their own copy
+    pool._sync_shared_files(mapdl, 1, files)
+    assert len(mapdl.uploaded) == 2
+
+    # modified files are sent again
+    shared.write("new content")
+    files = pool._checksum_shared_files([str(shared)])
+    pool._sync_shared_files(mapdl, 0, files)
+    assert len(mapdl.uploaded) == 3
+
+    with pytest.raises(FileNotFoundError):
+        pool._checksum_shared_files(["not_a_file.cdb"])
@@ -21,9 +21,12 @@
 # SOFTWARE.
 
 """Test ansys.mapdl.solution.Solution"""
+import time
+
 import pytest
 
 from ansys.mapdl.core.errors import MapdlRuntimeError
+from ansys.mapdl.core.solution import parse_solve_line
 
 
 def time_step_size(mapdl):
@@ -149,3 +152,121 @@ def test_exited(mapdl):
     with pytest.raises(MapdlRuntimeError):
         parm = mapdl.solution.time_step_size
     mapdl._exited = False
+
+
+@pytest.mark.parametrize(
+    "line,expected",
+    [
+        (
+            " FORCE CONVERGENCE VALUE   =  0.1234E+05  CRITERION=   123.4     <<< CONVERGED",
+            {
+                "type": "convergence",
+                "label": "FORCE",
+                "value": 12340.0,
+                "criterion": 123.4,
+                "converged": True,
+            },
+        ),
+        (
+            " EQUIL ITER   2 COMPLETED.  NEW TRIANG MATRIX.  MAX DOF INC=  0.1E-02",
+            {"type": "iteration", "iteration": 2},
+        ),
+        (
+            " *** LOAD STEP     1   SUBSTEP     3  COMPLETED.    CUM ITER =      7",
+            {"type": "substep", "load_step": 1, "substep": 3, "cum_iter": 7},
+        ),
+        (
+            " *** TIME =   0.300000         TIME INC =   0.100000",
+            {"type": "time", "time": 0.3, "time_inc": 0.1},
+        ),
+        (" >>> SOLUTION NOT CONVERGED", {"type": "not_converged"}),
+        (" SOLUTION OPTIONS", None),
+    ],
+)
+def test_parse_solve_line(line, expected):
+    assert parse_solve_line(line) == expected
+
+
+def test_solve_async(mapdl, cleared):
+    mapdl.et(1, "SOLID185")
+    mapdl.block(0, 1, 0, 1, 0, 1)
+    mapdl.esize(0.5)
+    mapdl.vmesh("ALL")
+    mapdl.mp("EX", 1, 210e9)
+    mapdl.mp("NUXY", 1, 0.3)
+    mapdl.nsel("S", "LOC", "X", 0)
+    mapdl.d("ALL", "ALL")
+    mapdl.nsel("S", "LOC", "X", 1)
+    mapdl.f("ALL", "FX", 1000)
+    mapdl.allsel()
+
+    mapdl.slashsolu()
+    mapdl.antype("STATIC")
+    mapdl.nlgeom("ON")
+    mapdl.nsubst(2, 2, 2)
+
+    events = []
+    handle = mapdl.solve_async(on_progress=events.append, stream_period=10)
+    assert handle.result(timeout=300)
+    assert handle.done
+    assert not handle.cancelled
+
+    assert events
+    assert handle.history == events
+    progress = handle.progress
+    assert progress["load_step"] == 1
+    assert progress["substep"] == 2
+
+    # Cancelling a finished solution does nothing
+    handle.cancel()
+    assert not handle.cancelled
+    mapdl.finish()
+
+
+def test_solve_async_cancel(mapdl, cleared):
+    mapdl.et(1, "SOLID185")
+    mapdl.block(0, 1, 0, 1, 0, 1)
+    mapdl.esize(0.5)
+    mapdl.vmesh("ALL")
+    mapdl.mp("EX", 1, 210e9)
+    mapdl.mp("NUXY", 1, 0.3)
+    mapdl.mp("DENS", 1, 7800)
+    mapdl.nsel("S", "LOC", "X", 0)
+    mapdl.d("ALL", "ALL")
+    mapdl.nsel("S", "LOC", "X", 1)
+    mapdl.f("ALL", "FX", 1000)
+    mapdl.allsel()
+
+    # Long transient analysis
+    n_substeps = 5000
+    mapdl.slashsolu()
+    mapdl.antype("TRANS")
+    mapdl.nlgeom("ON")
+    mapdl.time(1)
+    mapdl.nsubst(n_substeps, n_substeps, n_substeps)
+    mapdl.outres("ALL", "NONE")
+
+    handle = mapdl.solve_async(stream_period=10)
+    try:
+        tstart = time.time()
+        while (handle.progress["substep"] or 0) < 2:
+            assert not handle.done, "The solution finished before being cancelled"
+            assert time.time() - tstart < 300
+            time.sleep(0.1)
+
+        # Other commands are rejected while solving
+        with pytest.raises(MapdlRuntimeError, match="solve_async"):
+            mapdl.prep7()
+
+        handle.cancel()
+        assert handle.wait(timeout=300)
+    finally:
+        handle.cancel()
+        handle.wait()
+
+    assert handle.cancelled
+    assert handle.progress["substep"] < n_substeps
+    assert "SolveHandle" in repr(handle) and "cancelled" in repr(handle)
+
+    # Commands can be sent again
+    assert mapdl.finish()